@@ -24,10 +24,14 @@ package riscv_instr;
   localparam logic [31:0] CUSTOM3_RD         = 32'b?????????????????100?????1111011;
   localparam logic [31:0] CUSTOM3_RD_RS1     = 32'b?????????????????110?????1111011;
   localparam logic [31:0] CUSTOM3_RD_RS1_RS2 = 32'b?????????????????111?????1111011;
+  localparam logic [31:0] DIMC_INSTR_DMV     = 32'b?????????????????000?????1101011;
   localparam logic [31:0] DIMC_INSTR_LD_F    = 32'b?????????????????001?????1101011;
   localparam logic [31:0] DIMC_INSTR_LD_K    = 32'b?????????????????010?????1101011;
+  localparam logic [31:0] DIMC_INSTR_LD_KB   = 32'b?????????????????011?????1101011;
   localparam logic [31:0] DIMC_INSTR_DPS     = 32'b?????????????????100?????1101011;
   localparam logic [31:0] DIMC_INSTR_DSS     = 32'b?????????????????101?????1101011;
+  localparam logic [31:0] DIMC_INSTR_LD_Q    = 32'b?????????????????110?????1101011;
+  localparam logic [31:0] DIMC_INSTR_CFG     = 32'b?????????????????111?????1101011;
   localparam logic [31:0] DIMC_INSTR_MACVV   = 32'b?????????????????????????1011111;
   localparam logic [31:0] DMSRC              = 32'b0000000??????????000000000101011;
   localparam logic [31:0] DMDST              = 32'b0000001??????????000000000101011;
@@ -2436,10 +2436,14 @@ module snitch import snitch_pkg::*; import riscv_instr::*; #(
         end
       end
       // 1 source register (rs1)
+      riscv_instr::DIMC_INSTR_DMV,
       riscv_instr::DIMC_INSTR_LD_F,
       riscv_instr::DIMC_INSTR_LD_K,
+      riscv_instr::DIMC_INSTR_LD_KB,
       riscv_instr::DIMC_INSTR_DPS,
-      riscv_instr::DIMC_INSTR_DSS: begin
+      riscv_instr::DIMC_INSTR_DSS,
+      riscv_instr::DIMC_INSTR_LD_Q,
+      riscv_instr::DIMC_INSTR_CFG: begin
         if (RVV) begin
           write_rd        = 1'b0;
           uses_rd         = 1'b0;
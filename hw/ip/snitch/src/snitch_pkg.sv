@@ -135,7 +135,8 @@ package snitch_pkg;
   typedef enum int unsigned {
     TCDMDMA    = 0,
     SoCDMAOut  = 1,
-    BootROM    = 2
+    BootROM    = 2,
+    DIMCDMA    = 3
   } cluster_slave_dma_e;
 
   typedef enum int unsigned {
@@ -163,6 +164,12 @@ package snitch_pkg;
     logic retired_load;       // number of load instructions retired by the core
     logic retired_i;          // number of base instructions retired by the core
     logic retired_acc;        // number of offloaded instructions retired by the core
+    logic dimc_compute;       // computes issued to the DIMC macros
+    logic dimc_ld_f;          // DIMC feature sections written
+    logic dimc_ld_k;          // DIMC kernel sections written
+    logic dimc_stall_ready;   // cycles waiting on the DIMC macro pipeline
+    logic dimc_stall_fifo;    // cycles a DIMC compute waits on a full result FIFO
+    logic dimc_wb_conflict;   // cycles a DIMC result waits for the VRF write port
   } core_events_t;
 
   // SSRs
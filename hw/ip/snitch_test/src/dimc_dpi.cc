@@ -0,0 +1,63 @@
+// Copyright 2023 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+
+// DPI interface of the DIMC model, used by the `DIMC_COCHECK` mode of
+// `spatz_DIMC.sv` to compare every macro output against the C++ model.
+
+#include <svdpi.h>
+
+#include "dimc_model.hh"
+
+namespace {
+
+/// Convert a 256-bit DPI vector into 64-bit words.
+void to_words(const svBitVecVal *vec, uint64_t *words) {
+    for (unsigned w = 0; w < sim::DimcModel::SECTION_WORDS; ++w)
+        words[w] = uint64_t(vec[2 * w]) | (uint64_t(vec[2 * w + 1]) << 32);
+}
+
+}  // namespace
+
+extern "C" {
+
+void *dimc_model_new() { return new sim::DimcModel(); }
+
+void dimc_model_reset(void *model) {
+    static_cast<sim::DimcModel *>(model)->reset();
+}
+
+void dimc_model_write_kernel(void *model, int addr, const svBitVecVal *data,
+                             const svBitVecVal *mask) {
+    uint64_t d[sim::DimcModel::SECTION_WORDS], m[sim::DimcModel::SECTION_WORDS];
+    to_words(data, d);
+    to_words(mask, m);
+    static_cast<sim::DimcModel *>(model)->write_kernel(addr, d, m);
+}
+
+void dimc_model_load_feature(void *model, int sec, const svBitVecVal *data) {
+    uint64_t d[sim::DimcModel::SECTION_WORDS];
+    to_words(data, d);
+    static_cast<sim::DimcModel *>(model)->load_feature(sec, d);
+}
+
+void dimc_model_load_requant(void *model, int group,
+                             const svBitVecVal *entries) {
+    uint32_t e[sim::DimcModel::NR_QENTRIES];
+    for (unsigned i = 0; i < sim::DimcModel::NR_QENTRIES; ++i) e[i] = entries[i];
+    static_cast<sim::DimcModel *>(model)->load_requant(group, e);
+}
+
+/// Partial sum of a compute issued with the current model state.
+int dimc_model_mac(void *model, int row, int mode, int mct, int bias,
+                   int sections) {
+    return static_cast<sim::DimcModel *>(model)->mac(row, mode, mct, bias,
+                                                     sections);
+}
+
+/// Expected {res4[3:0], psout[23:0]} of a partial sum leaving the pipeline.
+int dimc_model_output(void *model, int row, int psum, int ocfg) {
+    auto out = static_cast<sim::DimcModel *>(model)->output(row, psum, ocfg);
+    return (int(out.res4) << 24) | int(out.psout);
+}
+}
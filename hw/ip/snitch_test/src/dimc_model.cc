@@ -0,0 +1,181 @@
+// Copyright 2023 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+
+#include "dimc_model.hh"
+
+#include <cstring>
+
+namespace sim {
+
+namespace {
+
+constexpr unsigned ROW_BITS = DimcModel::ROW_BITS;
+constexpr unsigned ROW_WORDS = DimcModel::ROW_WORDS;
+
+inline int32_t sext24(uint32_t v) { return int32_t(v << 8) >> 8; }
+
+/// Extend the `W`-bit lanes of a packed row into 16-bit integers. A signed
+/// lane is sign-extended, an unsigned one zero-extended, like the extra
+/// operand bit of the RTL.
+template <unsigned W>
+void unpack(const uint64_t *row, bool sgn, int16_t *out) {
+    constexpr unsigned LANES = 64 / W;
+    constexpr uint64_t MASK = (uint64_t(1) << W) - 1;
+    const int16_t sign = sgn ? int16_t(1 << (W - 1)) : 0;
+    for (unsigned w = 0; w < ROW_WORDS; ++w) {
+        for (unsigned l = 0; l < LANES; ++l) {
+            int16_t v = int16_t((row[w] >> (l * W)) & MASK);
+            out[w * LANES + l] = int16_t((v ^ sign) - sign);
+        }
+    }
+}
+
+/// Multi-bit dot product. The lanes are unpacked first so that the
+/// multiply-accumulate loop is a plain 16-bit dot product, which the compiler
+/// turns into SIMD multiply-add instructions on the host.
+template <unsigned W>
+int64_t dot_lanes(const uint64_t *kernel, const uint64_t *feature, bool sgn_k,
+                  bool sgn_f) {
+    constexpr unsigned N = ROW_BITS / W;
+    int16_t k[N], f[N];
+    unpack<W>(kernel, sgn_k, k);
+    unpack<W>(feature, sgn_f, f);
+
+    // |acc| <= 128 * 255 * 255 in 8-bit mode, which fits 32 bits
+    int32_t acc = 0;
+    for (unsigned i = 0; i < N; ++i) acc += int32_t(k[i]) * int32_t(f[i]);
+    return acc;
+}
+
+}  // namespace
+
+void DimcModel::reset() {
+    std::memset(kernel_, 0, sizeof(kernel_));
+    std::memset(feature_, 0, sizeof(feature_));
+    for (unsigned r = 0; r < NR_ROWS; ++r) {
+        qmult_[r] = 1;
+        qshift_[r] = 0;
+        qclip_[r] = 0xff;
+    }
+}
+
+void DimcModel::write_kernel(unsigned addr, const uint64_t *data,
+                             const uint64_t *mask) {
+    uint64_t *sec = const_cast<uint64_t *>(read_kernel(addr));
+    for (unsigned w = 0; w < SECTION_WORDS; ++w)
+        sec[w] = (sec[w] & ~mask[w]) | (data[w] & mask[w]);
+}
+
+void DimcModel::load_feature(unsigned sec, const uint64_t *data) {
+    std::memcpy(&feature_[(sec % NR_SECTIONS) * SECTION_WORDS], data,
+                SECTION_WORDS * sizeof(uint64_t));
+}
+
+void DimcModel::load_requant(unsigned group, const uint32_t *entries) {
+    for (unsigned i = 0; i < NR_QENTRIES; ++i) {
+        unsigned row = (group % 4) * NR_QENTRIES + i;
+        qmult_[row] = entries[i] & 0xffff;
+        qshift_[row] = (entries[i] >> 16) & 0x1f;
+        qclip_[row] = entries[i] >> 24;
+    }
+}
+
+int64_t DimcModel::dot(const uint64_t *kernel, const uint64_t *feature,
+                       unsigned mode, unsigned valid_bits) {
+    // Mask the tail of both operands
+    uint64_t k[ROW_WORDS], f[ROW_WORDS];
+    for (unsigned w = 0; w < ROW_WORDS; ++w) {
+        uint64_t keep;
+        if (valid_bits >= (w + 1) * 64)
+            keep = ~uint64_t(0);
+        else if (valid_bits <= w * 64)
+            keep = 0;
+        else
+            keep = (uint64_t(1) << (valid_bits - w * 64)) - 1;
+        k[w] = kernel[w] & keep;
+        f[w] = feature[w] & keep;
+    }
+
+    bool sgn_k = mode & MODE_SIGNED_K;
+    bool sgn_f = mode & MODE_SIGNED_F;
+
+    switch (mode & 0x3) {
+        case MODE_1B: {
+            // XNOR + popcount. Masked bits are zero in both operands and count
+            // as matches.
+            int64_t popcount = 0;
+            for (unsigned w = 0; w < ROW_WORDS; ++w)
+                popcount += __builtin_popcountll(~(k[w] ^ f[w]));
+            if (!sgn_k && !sgn_f) return popcount;
+            // Bipolar encoding: matches - mismatches over the valid bits
+            return 2 * (popcount - (ROW_BITS - valid_bits)) - valid_bits;
+        }
+        case MODE_2B:
+            return dot_lanes<2>(k, f, sgn_k, sgn_f);
+        case MODE_4B:
+            return dot_lanes<4>(k, f, sgn_k, sgn_f);
+        default:
+            return dot_lanes<8>(k, f, sgn_k, sgn_f);
+    }
+}
+
+uint32_t DimcModel::mac(unsigned row, unsigned mode, unsigned mct,
+                        uint32_t bias, unsigned sections) const {
+    uint64_t k[ROW_WORDS], f[ROW_WORDS];
+    for (unsigned w = 0; w < ROW_WORDS; ++w) {
+        bool enabled = (sections >> (w / SECTION_WORDS)) & 0x1;
+        k[w] = enabled ? kernel_[row % NR_ROWS][w] : 0;
+        f[w] = enabled ? feature_[w] : 0;
+    }
+
+    unsigned valid_bits = ROW_BITS - (mct & 0xff) * 4;
+    int64_t acc = dot(k, f, mode, valid_bits);
+    // 24-bit accumulator and bias adder, both wrapping
+    return uint32_t(acc + bias) & 0xffffff;
+}
+
+DimcModel::Output DimcModel::output(unsigned row, uint32_t psum,
+                                    unsigned ocfg) const {
+    Output out;
+    int32_t value = sext24(psum);
+    row %= NR_ROWS;
+
+    // ReLU + 4-bit saturation on RES_OUT/SOUT
+    if (value < 0)
+        out.res4 = 0;
+    else if (value > 15)
+        out.res4 = 15;
+    else
+        out.res4 = value;
+
+    unsigned act = ocfg & 0x3;
+    unsigned width = (ocfg >> 2) & 0x3;
+    if (width == OUT_RAW) {
+        out.psout = psum & 0xffffff;
+        return out;
+    }
+
+    // Requantization: (psum * mult + round) >>> shift
+    int64_t scaled = int64_t(value) * qmult_[row];
+    if (qshift_[row] != 0)
+        scaled = (scaled + (int64_t(1) << (qshift_[row] - 1))) >> qshift_[row];
+
+    unsigned bits = 8 >> (width - 1);
+    int64_t qmin, qmax;
+    if (act == ACT_NONE) {
+        qmin = -(int64_t(1) << (bits - 1));
+        qmax = (int64_t(1) << (bits - 1)) - 1;
+    } else {
+        qmin = 0;
+        qmax = (int64_t(1) << bits) - 1;
+        if (act == ACT_RELU6 && qclip_[row] < qmax) qmax = qclip_[row];
+    }
+
+    if (scaled < qmin) scaled = qmin;
+    if (scaled > qmax) scaled = qmax;
+    out.psout = uint32_t(scaled) & 0xffffff;
+    return out;
+}
+
+}  // namespace sim
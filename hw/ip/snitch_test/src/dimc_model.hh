@@ -0,0 +1,98 @@
+// Copyright 2023 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace sim {
+
+/// Functional model of one `DIMC_18_fixed` macro (`spatz_DIMC.sv`).
+///
+/// The model is transaction-level: a compute reads the kernel row, the feature
+/// buffer and the operation arguments when it is issued, and the output stage
+/// is applied separately, when the result leaves the macro pipeline. Results
+/// are bit-exact with the RTL with a 256-bit section width.
+struct DimcModel {
+    static constexpr unsigned NR_ROWS = 32;
+    static constexpr unsigned NR_SECTIONS = 4;
+    static constexpr unsigned SECTION_BITS = 256;
+    static constexpr unsigned ROW_BITS = NR_SECTIONS * SECTION_BITS;
+    static constexpr unsigned SECTION_WORDS = SECTION_BITS / 64;
+    static constexpr unsigned ROW_WORDS = ROW_BITS / 64;
+    static constexpr unsigned NR_QENTRIES = 8;
+
+    // MODE[1:0], compute resolution
+    static constexpr unsigned MODE_1B = 0;
+    static constexpr unsigned MODE_2B = 1;
+    static constexpr unsigned MODE_4B = 2;
+    static constexpr unsigned MODE_8B = 3;
+    // MODE[3:2], operand signedness
+    static constexpr unsigned MODE_SIGNED_K = 1 << 2;
+    static constexpr unsigned MODE_SIGNED_F = 1 << 3;
+
+    // OCFG[1:0], activation
+    static constexpr unsigned ACT_NONE = 0;
+    static constexpr unsigned ACT_RELU = 1;
+    static constexpr unsigned ACT_RELU6 = 2;
+    // OCFG[3:2], output width (0 returns the raw partial sum)
+    static constexpr unsigned OUT_RAW = 0;
+
+    /// Values presented on the macro outputs for one compute.
+    struct Output {
+        uint32_t psout;  // PSOUT[23:0]
+        uint8_t res4;    // {RES_OUT, SOUT}
+    };
+
+    DimcModel() { reset(); }
+
+    /// Clear the memories and restore the default requant table.
+    void reset();
+
+    /// Write kernel section `addr` = {row[4:0], sec[1:0]}. Only the bits set in
+    /// `mask` are written. `data` and `mask` hold SECTION_WORDS words each.
+    void write_kernel(unsigned addr, const uint64_t *data, const uint64_t *mask);
+
+    /// Kernel section `addr` = {row[4:0], sec[1:0]} (SECTION_WORDS words).
+    const uint64_t *read_kernel(unsigned addr) const {
+        return &kernel_[(addr >> 2) % NR_ROWS][(addr % NR_SECTIONS) *
+                                                SECTION_WORDS];
+    }
+
+    /// Load feature buffer section `sec` from SECTION_WORDS words.
+    void load_feature(unsigned sec, const uint64_t *data);
+
+    /// Load the requant entries of rows [8 * group, 8 * group + 8). Entry i is
+    /// {clip[31:24], shift[20:16], mult[15:0]}.
+    void load_requant(unsigned group, const uint32_t *entries);
+
+    /// Multiply kernel row `row` with the feature buffer and add `bias`. The
+    /// last `4 * mct` bits of both operands are masked, and so are the
+    /// sections whose bit in `sections` is clear. Returns the 24-bit partial
+    /// sum.
+    uint32_t mac(unsigned row, unsigned mode, unsigned mct, uint32_t bias,
+                 unsigned sections = 0xf) const;
+
+    /// Apply the output stage of row `row` to the partial sum `psum`.
+    Output output(unsigned row, uint32_t psum, unsigned ocfg) const;
+
+    /// Full compute, `mac` followed by `output`.
+    Output compute(unsigned row, unsigned mode, unsigned mct, uint32_t bias,
+                   unsigned ocfg) const {
+        return output(row, mac(row, mode, mct, bias), ocfg);
+    }
+
+    /// Dot product of two packed rows, not truncated to the accumulator width.
+    static int64_t dot(const uint64_t *kernel, const uint64_t *feature,
+                       unsigned mode, unsigned valid_bits);
+
+   private:
+    uint64_t kernel_[NR_ROWS][ROW_WORDS];
+    uint64_t feature_[ROW_WORDS];
+    uint16_t qmult_[NR_ROWS];
+    uint8_t qshift_[NR_ROWS];
+    uint8_t qclip_[NR_ROWS];
+};
+
+}  // namespace sim
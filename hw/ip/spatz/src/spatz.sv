@@ -64,7 +64,13 @@ module spatz import spatz_pkg::*; import rvv_pkg::*; import fpnew_pkg::*; #(
     // FPU side channel
     input  roundmode_e                        fpu_rnd_mode_i,
     input  fmt_mode_t                         fpu_fmt_mode_i,
-    output status_t                           fpu_status_o
+    output status_t                           fpu_status_o,
+    // DIMC kernel memory write port
+    input  dimc_kwr_t                         dimc_kwr_i,
+    input  logic                              dimc_kwr_valid_i,
+    output logic                              dimc_kwr_ready_o,
+    // DIMC performance counter events
+    output dimc_events_t                      dimc_events_o
   );
 
   ////////////////
@@ -299,7 +305,12 @@ module spatz import spatz_pkg::*; import rvv_pkg::*; import fpnew_pkg::*; #(
     .vrf_rvalid_i     (vrf_rvalid[VFU_VD_RD:VFU_VS2_RD]                        ),
     .vrf_id_o         ({sb_id[SB_VFU_VD_WD], sb_id[SB_VFU_VD_RD:SB_VFU_VS2_RD]}),
     // FPU side-channel
-    .fpu_status_o     (fpu_status_o                                            )
+    .fpu_status_o     (fpu_status_o                                            ),
+    // DIMC kernel memory write port
+    .dimc_kwr_i       (dimc_kwr_i                                              ),
+    .dimc_kwr_valid_i (dimc_kwr_valid_i                                        ),
+    .dimc_kwr_ready_o (dimc_kwr_ready_o                                        ),
+    .dimc_events_o    (dimc_events_o                                           )
   );
 
   //////////
@@ -5,7 +5,9 @@
     module DIMC_18_fixed #(
     
  	    //Parameter for Section Width
-    parameter SECTION_WIDTH = 256   // can be 256, 512, or 1024
+    parameter SECTION_WIDTH = 256,  // can be 256, 512, or 1024
+    //Kernel memory banks (1, 2, 4 or 8), contiguous groups of rows
+    parameter NUM_KBANKS = 2
 )(
 
     // System Interface
@@ -16,7 +18,8 @@
     output logic        READYN,     // Active-low ready (output valid)
     input  logic        COMPE,      // Operation mode (1=compute, -
     input  logic        FCSN,       // Feature buffer chip select (active-low)
-    input  logic [1:0]  MODE,       // Bit resolution (0=1b, 1=2b, 2=4b, 3=8b)
+    input  logic [3:0]  MODE,       // [1:0] bit resolution (0=1b, 1=2b, 2=4b, 3=8b)
+                                    // [2] signed kernel, [3] signed feature
     
     // Address/Data Interface
     input  logic [1:0]                  FA,        // Feature buffer address
@@ -24,7 +27,7 @@
     input  logic [23:0]                 ADDIN,     // Bias/partial sum input
     output logic                        SOUT,      // Sum output (LSB of result)
     output logic [2:0]                  RES_OUT,   // Result output (MSBs of 4-bit result)
-    output logic [23:0]                 PSOUT,     // Pre-ReLU output
+    output logic [23:0]                 PSOUT,     // Pre-ReLU output (requantized if OCFG[3:2] != 0)
     output logic [SECTION_WIDTH-1:0]    Q,         // Memory output
     input  logic [SECTION_WIDTH-1:0]    D,         // Memory input
     input  logic [6:0]                  RA,        // Memory address
@@ -32,17 +35,24 @@
     
     // Memory Control
     input  logic        RCSN,       // Read chip select (active-low)
-    input  logic        RCSN0,      // Computation control
-    input  logic        RCSN1,      // Computation control
-    input  logic        RCSN2,      // Computation control
-    input  logic        RCSN3,      // Computation control
+    input  logic        RCSN0,      // Section 0 compute enable (active-low)
+    input  logic        RCSN1,      // Section 1 compute enable (active-low)
+    input  logic        RCSN2,      // Section 2 compute enable (active-low)
+    input  logic        RCSN3,      // Section 3 compute enable (active-low)
     input  logic        WCK,        // Write clock
     input  logic        WCSN,       // Write chip select (active-low)
     input  logic        WEN,        // Write enable (active-low)
     
     // Masking Signals
     input  logic [SECTION_WIDTH-1:0]    M,         // Bitwise write mask
-    input  logic [7:0]                  MCT        // Masking coding thermometric
+    input  logic [7:0]                  MCT,       // Masking coding thermometric
+
+    // Output Stage
+    input  logic [3:0]                  OCFG,      // [1:0] activation (0=none, 1=ReLU, 2=ReLU6)
+                                                   // [3:2] output bits (0=raw PSOUT, 1=8b, 2=4b, 3=2b)
+    input  logic                        QCSN,      // Requant table write select (active-low)
+    input  logic [1:0]                  QA,        // Requant table group (rows QA*8 .. QA*8+7)
+    input  logic [255:0]                QD         // 8 entries {clip[31:24], shift[20:16], mult[15:0]}
     
    
 );
@@ -54,6 +64,7 @@
 
 localparam NUM_SECTIONS = 1024/SECTION_WIDTH;
 localparam ROW_WIDTH = NUM_SECTIONS * SECTION_WIDTH;
+localparam KBANK_ROWS = 32/NUM_KBANKS;
 
 //------------------------------------------------------------------------------
 // Memory Architecture
@@ -67,7 +78,9 @@ logic [NUM_SECTIONS-1:0][SECTION_WIDTH-1:0] feature_buf;       // 4 sections, 25
 logic compute_trigger;
 logic mem_read_en;
 logic mem_write_en;
+logic kbank_conflict;
 logic [10:0] valid_bits;
+logic [ROW_WIDTH-1:0] section_en;
 
 // Pipeline registers
 logic [3:0]  pipeline_valid;  // Valid flag for each stage
@@ -76,7 +89,9 @@ logic [23:0] pipeline_bias [0:3];
 logic [ROW_WIDTH-1:0] pipeline_kernel [0:3];
 logic [ROW_WIDTH-1:0] pipeline_feature [0:3];
 logic [23:0]  pipeline_result [0:3];
-logic [1:0]  pipeline_mode [0:3];
+logic [3:0]  pipeline_mode [0:3];
+logic [3:0]  pipeline_ocfg [0:3];
+logic [7:0]  pipeline_mct;
 
 // Computation intermediates
 logic [ROW_WIDTH-1:0] masked_kernel;
@@ -86,6 +101,12 @@ logic [23:0] comp_result;
 // Output logic
 logic [23:0] psum;
 logic [3:0] result_4bit;
+logic [23:0] qout;
+
+// Per-row requantization table
+logic [15:0] qmult  [31:0];
+logic [4:0]  qshift [31:0];
+logic [7:0]  qclip  [31:0];
 
 
 //------------------------------------------------------------------------------
@@ -93,14 +114,23 @@ logic [3:0] result_4bit;
 //------------------------------------------------------------------------------
 
 // Control signal assignments
-assign compute_trigger = COMPE & ~RCSN & ~RCSN0 & ~RCSN1 & ~RCSN2 & ~RCSN3;
+// Every kernel memory bank has its own write port next to the compute read
+// port, so a write only collides with a compute that reads the same bank in the
+// same cycle. The driver must hold such a write back; it is dropped here.
+assign compute_trigger = COMPE & ~RCSN;
 assign mem_read_en     = ~COMPE & ~RCSN;
-assign mem_write_en    = ~COMPE & ~WCSN & ~WEN;
+assign kbank_conflict  = compute_trigger && (WA[6:2] / KBANK_ROWS == RA[6:2] / KBANK_ROWS);
+assign mem_write_en    = ~WCSN & ~WEN & ~kbank_conflict;
 //assign WCK = RCK;  // Write clock tied to main clock
 
-// Valid bits calculation
+// Section enables: a disabled section reads as zero in both operands and
+// contributes nothing to the multi-bit products, so its kernel read is skipped
+assign section_en = {{(ROW_WIDTH/4){~RCSN3}}, {(ROW_WIDTH/4){~RCSN2}},
+                     {(ROW_WIDTH/4){~RCSN1}}, {(ROW_WIDTH/4){~RCSN0}}};
+
+// Valid bits calculation (MCT is sampled with the compute)
 always_comb begin
-    valid_bits = 1024 - (MCT * 4);
+    valid_bits = 1024 - (pipeline_mct * 4);
     if (valid_bits > 1024) valid_bits = 0;
 end
 
@@ -118,47 +148,59 @@ always_comb begin
 end
 
 // Stage 2: Computation logic
+// Operands are extended by one bit, which holds the sign when the operand is
+// signed and is zero otherwise, so all modes share one signed accumulator.
 always_comb begin
-    comp_result = 0;
-    
-    case (pipeline_mode[1])
+    automatic logic signed [23:0] acc = '0;
+    automatic logic sgn_k = pipeline_mode[1][2];
+    automatic logic sgn_f = pipeline_mode[1][3];
+
+    case (pipeline_mode[1][1:0])
         // 1-bit Mode: XNOR + Popcount
+        // Signed selects the bipolar (+1/-1) encoding: matches - mismatches
+        // over the valid bits (masked bits always match)
         2'b00: begin
             logic [ROW_WIDTH-1:0] xnor_result;
             logic [10:0] popcount;
             
             xnor_result = ~(masked_kernel ^ masked_feature);
             popcount = $countones(xnor_result);
-            comp_result = popcount;
+            if (sgn_k || sgn_f)
+                acc = 2 * ($signed({1'b0, popcount}) - (ROW_WIDTH - $signed({1'b0, valid_bits}))) -
+                      $signed({1'b0, valid_bits});
+            else
+                acc = popcount;
         end
         
         // 2-bit Mode: Vector multiplication
         2'b01: begin
             for (int i = 0; i < 512; i++) begin
-                automatic logic [1:0] k_val = masked_kernel[i*2 +: 2];
-                automatic logic [1:0] f_val = masked_feature[i*2 +: 2];
-                comp_result += k_val * f_val;
+                automatic logic signed [2:0] k_val = {sgn_k & masked_kernel[i*2+1], masked_kernel[i*2 +: 2]};
+                automatic logic signed [2:0] f_val = {sgn_f & masked_feature[i*2+1], masked_feature[i*2 +: 2]};
+                acc += k_val * f_val;
             end
         end
         
         // 4-bit Mode: Vector multiplication
         2'b10: begin
             for (int i = 0; i < 256; i++) begin
-                automatic logic [3:0] k_val = masked_kernel[i*4 +: 4];
-                automatic logic [3:0] f_val = masked_feature[i*4 +: 4];
-                comp_result += k_val * f_val;
+                automatic logic signed [4:0] k_val = {sgn_k & masked_kernel[i*4+3], masked_kernel[i*4 +: 4]};
+                automatic logic signed [4:0] f_val = {sgn_f & masked_feature[i*4+3], masked_feature[i*4 +: 4]};
+                acc += k_val * f_val;
             end
         end
         
         // Default: 8-bit Mode (vector multiplication)
         default: begin
              for (int i = 0; i < ROW_WIDTH/8; i++) begin
-                 automatic logic [7:0] k_val = masked_kernel[i*8 +: 8];
-                 automatic logic [7:0] f_val = masked_feature[i*8 +: 8];
-                 comp_result += k_val * f_val;
+                 automatic logic signed [8:0] k_val = {sgn_k & masked_kernel[i*8+7], masked_kernel[i*8 +: 8]};
+                 automatic logic signed [8:0] f_val = {sgn_f & masked_feature[i*8+7], masked_feature[i*8 +: 8]};
+                 acc += k_val * f_val;
              end
          end
    endcase
+
+    comp_result = acc;
 end
 
 // Stage 3: Output processing
@@ -177,6 +219,37 @@ always_comb begin
     end
 end
 
+// Stage 3: Programmable output stage
+// y = clamp(act((psum * mult + round) >>> shift)) to the selected output width.
+// Without activation the output is signed, with ReLU/ReLU6 it is unsigned and
+// ReLU6 additionally clips at the per-row value.
+always_comb begin
+    automatic logic [4:0]          row   = pipeline_row[2];
+    automatic logic [4:0]          shift = qshift[row];
+    automatic logic [3:0]          bits  = 4'd8 >> (pipeline_ocfg[2][3:2] - 1);
+    automatic logic signed [41:0]  scaled;
+    automatic logic signed [41:0]  qmin, qmax;
+
+    scaled = $signed(psum) * $signed({1'b0, qmult[row]});
+    if (shift != 0)
+        scaled = (scaled + (42'sd1 <<< (shift - 1))) >>> shift;
+
+    if (pipeline_ocfg[2][1:0] == 2'b00) begin
+        qmin = -(42'sd1 <<< (bits - 1));
+        qmax =  (42'sd1 <<< (bits - 1)) - 1;
+    end
+    else begin
+        qmin = 0;
+        qmax = (42'sd1 <<< bits) - 1;
+        if (pipeline_ocfg[2][1:0] == 2'b10 && $signed({34'b0, qclip[row]}) < qmax)
+            qmax = $signed({34'b0, qclip[row]});
+    end
+
+    if (scaled < qmin)      qout = qmin[23:0];
+    else if (scaled > qmax) qout = qmax[23:0];
+    else                    qout = scaled[23:0];
+end
+
 //------------------------------------------------------------------------------
 // Sequential Logic Blocks
 //------------------------------------------------------------------------------
@@ -196,7 +269,7 @@ always_ff @(posedge RCK or negedge RESETn) begin
         // Memory read
         if (mem_read_en) Q <= kernel_mem[RA[6:2]][RA[1:0]];
         
-        // Memory write
+        // Memory write, also during a compute on another bank
         if (mem_write_en) begin
             for (int i = 0; i < 256; i++) begin
                 if (M[i]) kernel_mem[WA[6:2]][WA[1:0]][i] <= D[i];
@@ -205,6 +278,22 @@ always_ff @(posedge RCK or negedge RESETn) begin
     end
 end
 
+// Requantization table loading
+always_ff @(posedge RCK or negedge RESETn) begin
+    if (!RESETn) begin
+        qmult  <= '{default: 16'd1};
+        qshift <= '{default: '0};
+        qclip  <= '{default: 8'hff};
+    end
+    else if (~QCSN) begin
+        for (int i = 0; i < 8; i++) begin
+            qmult [{QA, 3'(i)}] <= QD[i*32      +: 16];
+            qshift[{QA, 3'(i)}] <= QD[i*32 + 16 +: 5];
+            qclip [{QA, 3'(i)}] <= QD[i*32 + 24 +: 8];
+        end
+    end
+end
+
 // Pipeline Stage 0: Input
 always_ff @(posedge RCK or negedge RESETn) begin
     if (!RESETn) begin
@@ -212,6 +301,8 @@ always_ff @(posedge RCK or negedge RESETn) begin
         pipeline_row[0] <= 0;
         pipeline_bias[0] <= 0;
         pipeline_mode[0] <= 0;
+        pipeline_ocfg[0] <= 0;
+        pipeline_mct <= 0;
         pipeline_kernel[0] <= 0;
         pipeline_feature[0] <= 0;
     end
@@ -222,6 +313,8 @@ always_ff @(posedge RCK or negedge RESETn) begin
             pipeline_row[0]   <= RA[6:2];  // 5-bit row index
             pipeline_bias[0]  <= ADDIN;
             pipeline_mode[0]  <= MODE;
+            pipeline_ocfg[0]  <= OCFG;
+            pipeline_mct      <= MCT;
 
             if (SECTION_WIDTH == 256) begin
                 pipeline_kernel[0] <= {
@@ -229,27 +322,27 @@ always_ff @(posedge RCK or negedge RESETn) begin
                     kernel_mem[RA[6:2]][2],
                     kernel_mem[RA[6:2]][1],
                     kernel_mem[RA[6:2]][0]
-                };
+                } & section_en;
                 pipeline_feature[0] <= {
                     feature_buf[3],
                     feature_buf[2],
                     feature_buf[1],
                     feature_buf[0]
-                };
+                } & section_en;
             end
             else if (SECTION_WIDTH == 512) begin
                 pipeline_kernel[0] <= {
                     kernel_mem[RA[6:2]][1],
                     kernel_mem[RA[6:2]][0]
-                };
+                } & section_en;
                 pipeline_feature[0] <= {
                     feature_buf[1],
                     feature_buf[0]
-                };
+                } & section_en;
             end
             else if (SECTION_WIDTH == 1024) begin
-                pipeline_kernel[0] <= kernel_mem[RA[6:2]][0];
-                pipeline_feature[0] <= feature_buf[0];
+                pipeline_kernel[0] <= kernel_mem[RA[6:2]][0] & section_en;
+                pipeline_feature[0] <= feature_buf[0] & section_en;
             end
             else begin
                 pipeline_kernel[0] <= '0;  // default/fallback
@@ -266,6 +359,7 @@ always_ff @(posedge RCK or negedge RESETn) begin
         pipeline_row[1] <= 0;
         pipeline_bias[1] <= 0;
         pipeline_mode[1] <= 0;
+        pipeline_ocfg[1] <= 0;
         pipeline_kernel[1] <= 0;
         pipeline_feature[1] <= 0;
     end
@@ -274,6 +368,7 @@ always_ff @(posedge RCK or negedge RESETn) begin
         pipeline_row[1]   <= pipeline_row[0];
         pipeline_bias[1]  <= pipeline_bias[0];
         pipeline_mode[1]  <= pipeline_mode[0];
+        pipeline_ocfg[1]  <= pipeline_ocfg[0];
         pipeline_kernel[1] <= masked_kernel;
         pipeline_feature[1] <= masked_feature;
     end
@@ -286,6 +381,7 @@ always_ff @(posedge RCK or negedge RESETn) begin
         pipeline_row[2] <= 0;
         pipeline_bias[2] <= 0;
         pipeline_mode[2] <= 0;
+        pipeline_ocfg[2] <= 0;
         pipeline_result[2] <= 0;
     end
     else begin
@@ -293,6 +389,7 @@ always_ff @(posedge RCK or negedge RESETn) begin
         pipeline_row[2]   <= pipeline_row[1];
         pipeline_bias[2]  <= pipeline_bias[1];
         pipeline_mode[2]  <= pipeline_mode[1];
+        pipeline_ocfg[2]  <= pipeline_ocfg[1];
         pipeline_result[2] <= comp_result;
     end
 end
@@ -311,7 +408,7 @@ always_ff @(posedge RCK or negedge RESETn) begin
         pipeline_row[3]   <= pipeline_row[2];
         
         if (pipeline_valid[2]) begin 
-            PSOUT <= psum;
+            PSOUT <= (pipeline_ocfg[2][3:2] != 2'b00) ? qout : psum;
             SOUT <= result_4bit[0];
             RES_OUT <= result_4bit[3:1];
             READYN <= 0;
@@ -322,4 +419,68 @@ always_ff @(posedge RCK or negedge RESETn) begin
     end
 end
 
+`ifndef SYNTHESIS
+// A kernel write colliding with a compute on the same bank is a driver bug
+always @(posedge RCK) begin
+    if (RESETn && ~WCSN && ~WEN && kbank_conflict)
+        $error("[DIMC] Kernel write to row %0d dropped, compute on row %0d of the same bank",
+               WA[6:2], RA[6:2]);
+end
+`endif
+
+//------------------------------------------------------------------------------
+// Co-check against the C++ model (hw/ip/snitch_test/src/dimc_model.cc)
+//------------------------------------------------------------------------------
+
+`ifdef DIMC_COCHECK
+import "DPI-C" function chandle dimc_model_new();
+import "DPI-C" function void dimc_model_reset(input chandle model);
+import "DPI-C" function void dimc_model_write_kernel(input chandle model, input int addr,
+                                                     input bit [255:0] data, input bit [255:0] mask);
+import "DPI-C" function void dimc_model_load_feature(input chandle model, input int sec,
+                                                     input bit [255:0] data);
+import "DPI-C" function void dimc_model_load_requant(input chandle model, input int group,
+                                                     input bit [255:0] entries);
+import "DPI-C" function int dimc_model_mac(input chandle model, input int row, input int mode,
+                                           input int mct, input int bias, input int sections);
+import "DPI-C" function int dimc_model_output(input chandle model, input int row, input int psum,
+                                              input int ocfg);
+
+chandle model;
+int     model_psum [$];
+
+initial begin
+    if (SECTION_WIDTH != 256)
+        $fatal(1, "[DIMC] The co-check model only supports 256-bit sections");
+    model = dimc_model_new();
+end
+
+// The model sees every operation with the values sampled at the clock edge,
+// before the RTL state is updated: computes first, then the memory writes.
+always @(posedge RCK or negedge RESETn) begin
+    if (!RESETn) begin
+        dimc_model_reset(model);
+        model_psum.delete();
+    end
+    else begin
+        if (compute_trigger)
+            model_psum.push_back(dimc_model_mac(model, RA[6:2], MODE, MCT, ADDIN,
+                                                {~RCSN3, ~RCSN2, ~RCSN1, ~RCSN0}));
+
+        if (pipeline_valid[2] && model_psum.size() != 0) begin
+            automatic logic [23:0] psout = (pipeline_ocfg[2][3:2] != 2'b00) ? qout : psum;
+            automatic int expected = dimc_model_output(model, pipeline_row[2],
+                                                       model_psum.pop_front(), pipeline_ocfg[2]);
+            if ({result_4bit, psout} !== expected[27:0])
+                $error("[DIMC] Row %0d: PSOUT %06x (%01x), model %06x (%01x)", pipeline_row[2],
+                       psout, result_4bit, expected[23:0], expected[27:24]);
+        end
+
+        if (~FCSN) dimc_model_load_feature(model, FA, FD);
+        if (mem_write_en) dimc_model_write_kernel(model, WA, D, M);
+        if (~QCSN) dimc_model_load_requant(model, QA, QD);
+    end
+end
+`endif
+
 endmodule
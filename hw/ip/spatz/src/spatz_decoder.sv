@@ -1255,10 +1255,14 @@ module spatz_decoder
 
          
           // Example: DIMC variants (I-type style immediate)
+          riscv_instr::DIMC_INSTR_DMV,
           riscv_instr::DIMC_INSTR_LD_F,
           riscv_instr::DIMC_INSTR_LD_K,
+          riscv_instr::DIMC_INSTR_LD_KB,
           riscv_instr::DIMC_INSTR_DPS,
-          riscv_instr::DIMC_INSTR_DSS: begin 
+          riscv_instr::DIMC_INSTR_DSS,
+          riscv_instr::DIMC_INSTR_LD_Q,
+          riscv_instr::DIMC_INSTR_CFG: begin 
 
            // decode standard I-type fields
            automatic logic [11:0] imm12 = decoder_req_i.instr[31:20];    // 12-bit immediate
@@ -1285,7 +1289,9 @@ module spatz_decoder
            spatz_req.op_cfg.dimc.k_row = imm12[6:2];   // k-row
            spatz_req.op_cfg.dimc.sec   = imm12[1:0];   // section / sec value
            spatz_req.op_cfg.dimc.flags = imm12[11:7];  // extra flags / address nibble (if needed)
+           spatz_req.op_cfg.dimc.macro = 3'd0;         // DPS/DSS broadcast to all macros
            spatz_req.op_cfg.dimc.mode  = 7'd0; // no funct7 for I-type
+           spatz_req.op_cfg.dimc.loop  = 1'b0;
 
            // Where you decode the instruction
            /*$display("[DIMC_INSTR] Time %t: vd=v%0d, vs1=v%0d, imm12=0x%h", 
@@ -1296,18 +1302,60 @@ module spatz_decoder
              riscv_instr::DIMC_INSTR_LD_K: begin
                spatz_req.op_cfg.dimc.cmd = DIMC_CMD_LD_K;
                spatz_req.use_rd          = 1'b0; // LD_K likely doesn’t write integer rd
+               // LD_K does not write the VRF: the vd field selects the target macro
+               spatz_req.op_cfg.dimc.macro = vd[2:0];
+             end
+
+             riscv_instr::DIMC_INSTR_LD_KB: begin
+               // Burst LD_K: {k_row, sec} is the first section, flags holds the
+               // number of sections minus one, read from consecutive VRF words of vs1
+               spatz_req.op_cfg.dimc.cmd   = DIMC_CMD_LD_KB;
+               spatz_req.op_cfg.dimc.macro = vd[2:0];
              end
 
              riscv_instr::DIMC_INSTR_LD_F: begin
               spatz_req.op_cfg.dimc.cmd = DIMC_CMD_LD_F;
              end
 
+             riscv_instr::DIMC_INSTR_LD_Q: begin
+               // Output stage: flags[1:0] activation, flags[3:2] output width,
+               // flags[4] keeps the requant table; k_row[4:3] picks the table group
+               spatz_req.op_cfg.dimc.cmd   = DIMC_CMD_LD_Q;
+               spatz_req.op_cfg.dimc.macro = vd[2:0];
+             end
+
+             riscv_instr::DIMC_INSTR_CFG: begin
+               // Configuration write: the value comes from the scalar rs1 and
+               // imm12[11:8] (flags[4:1]) selects the register (0: MCT)
+               spatz_req.op_cfg.dimc.cmd = DIMC_CMD_CFG;
+               spatz_req.rs1             = decoder_req_i.rs1;
+               spatz_req.use_vs1         = 1'b0;
+             end
+
+             riscv_instr::DIMC_INSTR_DMV: begin
+               // Matrix-vector: a DSS sweep over the resident rows starting at
+               // k_row, 32 results written to the vd register group.
+               // flags[1:0] resolution, flags[2] accumulates onto vd,
+               // imm12[1:0] signedness
+               spatz_req.op_cfg.dimc.cmd       = DIMC_CMD_DSS;
+               spatz_req.op_cfg.dimc.loop      = 1'b1;
+               spatz_req.op_cfg.dimc.mode[5:4] = imm12[1:0];
+               spatz_req.op_cfg.dimc.sec       = 2'd0;
+               spatz_req.use_vs1               = 1'b0;
+             end
+
              riscv_instr::DIMC_INSTR_DPS: begin
               spatz_req.op_cfg.dimc.cmd = DIMC_CMD_DPS;
+              // Computes do not address a section: imm12[1:0] selects signedness
+              // ([0] signed kernel, [1] signed feature), carried in mode[5:4] as for MACVV
+              spatz_req.op_cfg.dimc.mode[5:4] = imm12[1:0];
+              spatz_req.op_cfg.dimc.sec       = 2'd0;
              end
             
              default: begin
               spatz_req.op_cfg.dimc.cmd = DIMC_CMD_DSS;
+              spatz_req.op_cfg.dimc.mode[5:4] = imm12[1:0];
+              spatz_req.op_cfg.dimc.sec       = 2'd0;
              end
             endcase
            // any additional fields required by your DIMC execution unit:
@@ -1345,12 +1393,13 @@ module spatz_decoder
 
             // Optional: funct7 sub-modes
             spatz_req.op_cfg.dimc.ci = funct3;
-            // Optional: funct7 sub-modes
+            // funct7 sub-modes: [1:0] resolution, [3] psin, [5:4] signedness
             spatz_req.op_cfg.dimc.mode = funct7;
             // k_row/sec/flags unused for R-type
             spatz_req.op_cfg.dimc.k_row = 5'd0;
             spatz_req.op_cfg.dimc.sec   = 2'd0;
             spatz_req.op_cfg.dimc.flags = 5'd0;
+            spatz_req.op_cfg.dimc.macro = 3'd0;  // MACVV runs on macro 0 only
 
             /*$display("[DIMC_MACVV] t=%0t vd=v%0d vs1=v%0d vs2=v%0d",
                       $time, vd, vs1, vs2);*/
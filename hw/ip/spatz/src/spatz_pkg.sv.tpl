@@ -25,6 +25,20 @@ package spatz_pkg;
 % endif
   // Number of FUs in each VFU
   localparam int unsigned N_FU  = N_IPU > N_FPU ? N_IPU : N_FPU;
+% if cfg['mempool']:
+  // Number of DIMC macros in each VFU (1, 2, 4 or 8)
+  localparam int unsigned N_DIMC = `ifdef N_DIMC `N_DIMC `else 1 `endif;
+% else :
+  // Number of DIMC macros in each VFU (1, 2, 4 or 8)
+  localparam int unsigned N_DIMC = ${cfg['n_dimc']};
+% endif
+  // Kernel memory banks of each DIMC macro. Kernel writes proceed while the
+  // macro computes on a row of another bank.
+% if cfg['mempool']:
+  localparam int unsigned DIMC_KBANKS = `ifdef DIMC_KBANKS `DIMC_KBANKS `else 2 `endif;
+% else :
+  localparam int unsigned DIMC_KBANKS = ${cfg['n_dimc_kbanks']};
+% endif
   // FPU support
   localparam bit FPU            = N_FPU != 0;
 % if cfg['mempool']:
@@ -178,7 +192,10 @@ package spatz_pkg;
     DIMC_CMD_LD_F = 3'd1,
     DIMC_CMD_DPS  = 3'd2,
     DIMC_CMD_DSS  = 3'd3,
-    DIMC_CMD_MACVV = 3'd4  
+    DIMC_CMD_MACVV = 3'd4,
+    DIMC_CMD_LD_KB = 3'd5,  // burst LD_K: imm12[11:7]+1 sections from a register group
+    DIMC_CMD_LD_Q  = 3'd6,  // output stage: requant table group and activation/width
+    DIMC_CMD_CFG   = 3'd7   // configuration register write from rs1 (MCT)
   } dimc_cmd_e;
 
   // Per-instruction DIMC configuration carried through spatz_req.op_cfg.dimc
@@ -186,11 +203,30 @@ package spatz_pkg;
     logic [4:0]    k_row;   // imm[4:0] (adjust if your imm slices differ)
     logic [1:0]    sec;     // imm[6:5]
     logic [4:0]    flags;   // imm[11:7] (extra flags / small immediate)
+    logic [2:0]    macro;   // LD_K: target DIMC macro (vd[2:0])
     logic [6:0]    mode;    // I-type: packed imm OR R-type: funct7
     logic [2:0]    ci;      // R-type: funct3
+    logic          loop;    // DMV: sweep the resident rows into a vector
     dimc_cmd_e     cmd;     // command variant (LD_K / LD_F / DPS / DSS)
   } dimc_cfg_t;
 
+  // Kernel memory write from the cluster DMA (bypasses the VRF)
+  typedef struct packed {
+    logic [2:0]    macro;   // target DIMC macro
+    logic [6:0]    addr;    // {k_row, sec}
+    logic [255:0]  data;    // one kernel section
+  } dimc_kwr_t;
+
+  // DIMC event strobes, counted by the cluster performance counters
+  typedef struct packed {
+    logic compute;       // compute issued to the macros
+    logic ld_f;          // feature section written
+    logic ld_k;          // kernel section written (VRF or DMA)
+    logic stall_ready;   // results in flight, waiting on the macro pipeline
+    logic stall_fifo;    // compute held back by a full result FIFO
+    logic wb_conflict;   // DIMC result waiting for a VRF write port
+  } dimc_events_t;
+
   typedef struct packed {
     logic keep_vl;
     logic write_vstart;
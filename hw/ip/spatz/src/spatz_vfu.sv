@@ -42,6 +42,11 @@ module spatz_vfu
     input  logic       [2:0] vrf_rvalid_i,        //Vector register file read data valid
     // FPU side channel
     output status_t          fpu_status_o,        //Floating-point unit exception status
+    // DIMC kernel memory write port (cluster DMA)
+    input  dimc_kwr_t        dimc_kwr_i,          //Kernel section written by the DMA
+    input  logic             dimc_kwr_valid_i,    //Kernel section is valid
+    output logic             dimc_kwr_ready_o,    //Kernel section accepted
+    output dimc_events_t     dimc_events_o,       //DIMC performance counter events
     // DIMC outputs
     output logic [23:0]      dimc_psout_o,
     output logic             dimc_sout_o,
@@ -113,6 +118,29 @@ module spatz_vfu
   logic [3:0] macvv_result_counter;
   logic macvv_loading_active;
   logic macvv_instruction_active;  // Flag that stays high until MACVV completes
+
+  // Burst LD_K sequencer
+  logic [4:0] dimc_ldk_count_q;     // Sections already written by the current burst
+  logic       dimc_ldk_burst;       // Burst LD_K waiting for its VRF words
+  logic       dimc_ldk_burst_done;  // Last section of the burst is being written
+
+  // Output stage configuration (set by LD_Q)
+  logic [3:0] dimc_ocfg_q;          // [1:0] activation, [3:2] output width
+  logic [1:0] dimc_pack_q;          // Output width of the running loop-mode compute
+  logic       dimc_qtab_we;         // LD_Q writes a requant table group
+
+  // Sparsity and ragged-K support
+  logic [7:0] dimc_mct_q;           // Tail mask of DPS/DSS computes (set by CFG)
+  logic [3:0] dimc_fzero_q;         // Feature buffer section is all-zero
+  logic [3:0] dimc_skip_sec;        // Sections left out of the compute
+
+  // Accumulator bank of the DMV accumulator modes, one entry per result
+  logic [31:0][23:0] dimc_acc_q;
+  logic [4:0] dimc_acc_idx_q;       // Accumulator of the next issued compute
+  logic       dimc_acc_rd;          // DMV computes on top of the accumulators
+  logic       dimc_acc_drain;       // DMV only reads out the accumulators
+  logic       dimc_acc_keep;        // DMV results go to the accumulators, not the VRF
+  logic [1:0] fifo_head_acc;        // Accumulator mode of the DMV returning results
   
   // Vector length counter
   vlen_t vl_q, vl_d;
@@ -181,6 +209,7 @@ module spatz_vfu
   logic is_fpu_busy; 
   logic is_ipu_busy;
   logic is_dimc_busy; //DIMC
+  logic dimc_fifo_full; // No room to track another DIMC compute
 
   // Scalar results (sent back to Snitch)
   elen_t scalar_result;
@@ -208,7 +237,8 @@ module spatz_vfu
 
   logic compute_pulse;
   // DIMC Loop Mode Control
-  logic         dimc_loop_mode;
+  logic         dimc_loop_mode;     // DMV: sweep the resident rows into a vector
+  logic         dimc_psin_en;       // DSS adds the partial sums held in vd
   logic [5:0]   start_counter;      // Counts started computations (0-31)
   logic [5:0]   result_counter;     // Counts received results (0-31)
   logic         comp_active;        // Active while starting computations
@@ -222,8 +252,20 @@ module spatz_vfu
   logic         psin_write;        // Trigger for 256-bit VRF write
   logic         burst_write;        // Trigger for 256-bit VRF write
   logic [1:0]   vrf_chunk_idx;      // Which VRF chunk (0-3)
+  logic [255:0] dimc_burst_wdata;   // Burst write data (packed if the output stage narrows)
+  logic [31:0]  dimc_burst_wbe;     // Burst write byte enable
   logic [N_FU*ELEN-1:0] dimc_result_wide;// Create 256-bit result with 32-bit element in correct position
   logic         fifo_head_is_loop;
+  logic [3:0]   dimc_results_per_beat; // Results returned per DIMC beat (one per macro, MACVV uses macro 0)
+  logic         dimc_macvv_active;     // MACVV owns the DIMC array
+
+  // With N_DIMC macros each DPS/DSS step returns N_DIMC output channels, so the
+  // loop mode sweeps only 32/N_DIMC kernel rows to produce its 32 results.
+  localparam int unsigned DIMCLoopRows       = 32 / N_DIMC;
+  // Loop steps filling one 8-element VRF chunk
+  localparam int unsigned DIMCRowsPerChunk   = 8 / N_DIMC;
+  // Stop issuing once the results still in the 3-deep pipeline complete the 32
+  localparam int unsigned DIMCLoopIssueLimit = 32 - 3 * N_DIMC;
   
   // Are we producing the upper or lower part of the results  of a narrowing instruction?
   logic narrowing_upper_d, narrowing_upper_q;
@@ -346,9 +388,9 @@ module spatz_vfu
       // Finished the execution!
   if (spatz_req_valid && 
       (((vl_d >= spatz_req.vl && !spatz_req.op_arith.is_reduction) || reduction_done) ||
-       (is_dimc_insn && (spatz_req.op_cfg.dimc.cmd inside {DIMC_CMD_LD_F, DIMC_CMD_LD_K} ||
-       (spatz_req.op_cfg.dimc.cmd inside {DIMC_CMD_DSS, DIMC_CMD_DPS}&&(result_counter == 6'd32||spatz_req.vs1[0] == 1'b0))||
-       ((!is_dimc_busy && !spatz_req.op_cfg.dimc.cmd inside {DIMC_CMD_MACVV} && macvv_state_q == MACVV_IDLE)||
+       (is_dimc_insn && (spatz_req.op_cfg.dimc.cmd inside {DIMC_CMD_LD_F, DIMC_CMD_LD_K, DIMC_CMD_LD_Q, DIMC_CMD_CFG} || dimc_ldk_burst_done ||
+       (spatz_req.op_cfg.dimc.cmd inside {DIMC_CMD_DSS, DIMC_CMD_DPS}&&(result_counter == 6'd32||(!dimc_loop_mode && !dimc_fifo_full)))||
+       ((!is_dimc_busy && !dimc_fifo_full && spatz_req.op_cfg.dimc.cmd != DIMC_CMD_LD_KB && !spatz_req.op_cfg.dimc.cmd inside {DIMC_CMD_MACVV} && macvv_state_q == MACVV_IDLE)||
        (spatz_req.op_cfg.dimc.cmd inside {DIMC_CMD_MACVV} && burst_write )))))) begin //IME
     spatz_req_ready         = spatz_req_valid;
     busy_d                  = 1'b0;
@@ -373,7 +415,8 @@ module spatz_vfu
   // An instruction finished execution
   if ((result_tag.last && &(result_valid | ~pending_results) && reduction_state_q inside {Reduction_NormalExecution, Reduction_Wait}) || 
       reduction_done ||
-      (is_dimc_insn && (spatz_req.op_cfg.dimc.cmd inside {DIMC_CMD_LD_F, DIMC_CMD_LD_K} || !is_dimc_busy))) begin
+      (is_dimc_insn && (spatz_req.op_cfg.dimc.cmd inside {DIMC_CMD_LD_F, DIMC_CMD_LD_K, DIMC_CMD_LD_Q, DIMC_CMD_CFG} || dimc_ldk_burst_done ||
+                        (spatz_req.op_cfg.dimc.cmd != DIMC_CMD_LD_KB && !is_dimc_busy && !dimc_fifo_full)))) begin
     vfu_rsp_o.id      = result_tag.id;
     vfu_rsp_o.rd      = result_tag.vd_addr[GPRWidth-1:0];
     vfu_rsp_o.wb      = result_tag.wb;
@@ -704,6 +747,11 @@ module spatz_vfu
     if (spatz_req.op_cfg.dimc.cmd inside {DIMC_CMD_LD_F, DIMC_CMD_LD_K} && spatz_req.op_cfg.dimc.flags[0]== 1) begin
         vrf_raddr_o[1] = ((spatz_req.vs1  << $clog2(NrWordsPerVector)) + 1);
     end
+
+    // Burst LD_K walks the register group starting at vs1, one section per VRF word
+    if (dimc_ldk_burst) begin
+        vrf_raddr_o[1] = ((spatz_req.vs1  << $clog2(NrWordsPerVector)) + dimc_ldk_count_q);
+    end
     
      // OVERRIDE FOR PSIN
     if (compute_pulse && spatz_req.op_cfg.dimc.cmd inside {DIMC_CMD_DSS, DIMC_CMD_DPS}) begin
@@ -711,7 +759,7 @@ module spatz_vfu
         // align the address
         vrf_raddr_o[2] = ((spatz_req.vd  << $clog2(NrWordsPerVector))+psin_chunk_idx); //6'h3E
           if (psin_write) begin
-              if (spatz_req.vs1[1] == 1'b1) begin
+              if (dimc_psin_en) begin
                 dimc_buffer_psin_2 = vrf_rdata_i[2];
               end else begin //check and make 0 if partial sum not need to be added
                 dimc_buffer_psin_2 = '0;
@@ -751,6 +799,36 @@ module spatz_vfu
 
   assign current_element_idx = dimc_element_sel; // Direct from instruction
   
+  // With a narrow output stage, the 8 results of a burst are packed densely
+  // into the first VRF word of vd: chunk k fills bytes [k*b, (k+1)*b) for b-bit
+  // outputs, so the 32 outputs of a loop occupy 32*b bits.
+  always_comb begin : dimc_pack_proc
+    dimc_burst_wdata = dimc_buffer;
+    dimc_burst_wbe   = '1;
+
+    if (dimc_pack_q != 2'b00 && !macvv_instruction_active) begin
+      dimc_burst_wdata = '0;
+      dimc_burst_wbe   = '0;
+      unique case (dimc_pack_q)
+        2'b01: begin
+          for (int i = 0; i < 8; i++)
+            dimc_burst_wdata[vrf_chunk_idx * 64 + i * 8 +: 8] = dimc_buffer[i * 32 +: 8];
+          dimc_burst_wbe[vrf_chunk_idx * 8 +: 8] = '1;
+        end
+        2'b10: begin
+          for (int i = 0; i < 8; i++)
+            dimc_burst_wdata[vrf_chunk_idx * 32 + i * 4 +: 4] = dimc_buffer[i * 32 +: 4];
+          dimc_burst_wbe[vrf_chunk_idx * 4 +: 4] = '1;
+        end
+        default: begin
+          for (int i = 0; i < 8; i++)
+            dimc_burst_wdata[vrf_chunk_idx * 16 + i * 2 +: 2] = dimc_buffer[i * 32 +: 2];
+          dimc_burst_wbe[vrf_chunk_idx * 2 +: 2] = '1;
+        end
+      endcase
+    end
+  end : dimc_pack_proc
+
   always_comb begin : operand_req_proc
     vreg_r_req = '0;
     vreg_we    = '0;
@@ -783,6 +861,13 @@ module spatz_vfu
         end
     end
 
+    // Burst LD_K streams vs1 until the last section is written
+    if (dimc_ldk_burst) begin
+      vreg_r_req[1] = 1'b1;
+      vreg_r_req[0] = 1'b0;
+      vreg_r_req[2] = 1'b0;
+    end
+
     
     // Got a new result
     if (&(result_valid | ~pending_results) && !result_tag.reduction) begin
@@ -798,15 +883,17 @@ module spatz_vfu
           vreg_we = 1'b1;
   
           // Extract correct chunk from buffer
-          dimc_vreg_wdata = dimc_buffer;
-          vreg_wbe = '1;  // Enable all 32 bytes (256 bits)
+          dimc_vreg_wdata = dimc_burst_wdata;
+          vreg_wbe = dimc_burst_wbe;  // All 32 bytes, or the packed chunk
         end 
           // ===== SINGLE MODE WRITE =====
         else if (!fifo_head_is_loop) begin  // FIX: Check both flags after !dimc_loop_mode && !dimc_loop_active
           // SINGLE MODE: Original logic
           vreg_wbe = '0;
           // FIX: Use current_element_idx (which comes from FIFO head for single mode)
-          vreg_wbe[current_element_idx * 4 +: 4] = 4'b1111;
+          // Every macro returns its own output channel, stored in consecutive elements
+          for (int m = 0; m < N_DIMC; m++)
+            vreg_wbe[3'(current_element_idx + m) * 4 +: 4] = 4'b1111;
           dimc_vreg_wdata = dimc_result_wide;
         end
       end
@@ -837,8 +924,8 @@ module spatz_vfu
       vreg_we = 1'b1;
       dimc_write_active = 1'b1;
       //dimc_vreg_wdata = dimc_buffer[vrf_chunk_idx * 256 +: 256];
-      dimc_vreg_wdata = dimc_buffer;
-      vreg_wbe = '1;
+      dimc_vreg_wdata = dimc_burst_wdata;
+      vreg_wbe = dimc_burst_wbe;
     end
   end : operand_req_proc
 
@@ -1274,14 +1361,19 @@ module spatz_vfu
   logic        dimc_ready;
   logic [3:0]  dimc_result_4bit;
   logic [23:0] dimc_psout;
+
+  // Per-macro DIMC outputs
+  logic [N_DIMC-1:0]       dimc_ready_macro;
+  logic [N_DIMC-1:0][3:0]  dimc_result_4bit_macro;
+  logic [N_DIMC-1:0][23:0] dimc_psout_macro;
   
   
   logic        _COMPE;
   logic        _FCSN ;
-  logic [1:0]  _MODE ;
+  logic [3:0]  _MODE ;
   logic [1:0]  _FA   ;
   logic [255:0]_FD   ;
-  logic [23:0]_ADDIN ;
+  logic [N_DIMC-1:0][23:0]_ADDIN ; // Per-macro bias/partial sum
   logic [255:0]_Q    ;
   logic [255:0]_D    ;
   logic [7:0]  _RA   ;
@@ -1300,7 +1392,7 @@ module spatz_vfu
   
   // DIMC element select from instruction
 
-  logic [31:0] dimc_32bit_result;// Create 32-bit result from 24-bit PS output (signed-extend to 32-bit)
+  logic [N_DIMC-1:0][31:0] dimc_32bit_result;// Create 32-bit result from 24-bit PS output (signed-extend to 32-bit)
   
   // FIFO to track vd for in-flight DIMC computations
   logic [8:0] dimc_vd_fifo [0:3];      // 4-entry FIFO (max 4 in-flight) vd+sel bits [7:5]=element_sel, bits [4:0]=vd after [8]   : is_loop
@@ -1313,16 +1405,33 @@ module spatz_vfu
   vfu_tag_t dimc_tag_fifo [0:3];
   
 
-  assign dimc_loop_mode = spatz_req.use_vs1 && (spatz_req.vs1[0] == 1'b1);
+  assign dimc_loop_mode = spatz_req.op_cfg.dimc.loop;
+  // DMV accumulates with flags[2], a single DSS when vs1[1] is set
+  assign dimc_psin_en   = dimc_loop_mode ? spatz_req.op_cfg.dimc.flags[2] : spatz_req.vs1[1];
+
+  // DMV accumulator modes, flags[4:3]:
+  //   01: add the results into the accumulators, no VRF write
+  //   10: add the accumulators to the results, write vd and clear them
+  //   11: drain, write the accumulators to vd (no dot product) and clear them
+  assign dimc_acc_rd    = dimc_loop_mode && |spatz_req.op_cfg.dimc.flags[4:3];
+  assign dimc_acc_drain = dimc_loop_mode && &spatz_req.op_cfg.dimc.flags[4:3];
+  assign dimc_acc_keep  = dimc_loop_mode && spatz_req.op_cfg.dimc.flags[4:3] == 2'b01;
+
+  // A DPS/DSS/DMV only starts once the FIFO can track it, and waits otherwise
+  assign dimc_fifo_full = dimc_fifo_count == 4;
 
   assign compute_pulse = (spatz_req_valid && 
-                       ((spatz_req.op_cfg.dimc.cmd == DIMC_CMD_DSS && result_counter < 29) ||
-                        (spatz_req.op_cfg.dimc.cmd == DIMC_CMD_DPS && result_counter < 29) ||
+                       ((spatz_req.op_cfg.dimc.cmd == DIMC_CMD_DSS && result_counter < DIMCLoopIssueLimit && !dimc_fifo_full) ||
+                        (spatz_req.op_cfg.dimc.cmd == DIMC_CMD_DPS && result_counter < DIMCLoopIssueLimit && !dimc_fifo_full) ||
                         (spatz_req.op_cfg.dimc.cmd == DIMC_CMD_MACVV && macvv_state_q == MACVV_COMPUTE)));
     
   // MACVV loading active flag
   assign macvv_loading_active = (macvv_state_q inside {MACVV_LOAD_FEATURE, MACVV_LOAD_KERNEL});
 
+  // MACVV only uses macro 0, DPS/DSS return one result per macro
+  assign dimc_macvv_active     = spatz_req.op_cfg.dimc.cmd == DIMC_CMD_MACVV || macvv_instruction_active;
+  assign dimc_results_per_beat = macvv_instruction_active ? 4'd1 : 4'(N_DIMC);
+
   // Update _select_F and _select_K for MACVV
   assign _select_F = ~(spatz_req_valid && 
                       ((spatz_req.op_cfg.dimc.cmd == DIMC_CMD_LD_F) ||
@@ -1334,6 +1443,7 @@ module spatz_vfu
 
   
   assign fifo_head_is_loop = (dimc_fifo_count > 0) && dimc_vd_fifo[dimc_fifo_head][8]; //after
+  assign fifo_head_acc     = fifo_head_is_loop ? dimc_vd_fifo[dimc_fifo_head][7:6] : 2'b00;
 
 
   // Use read port 0 for DIMC VRF access
@@ -1341,7 +1451,7 @@ module spatz_vfu
     if (spatz_req.op_cfg.dimc.cmd == DIMC_CMD_LD_F) begin: gen_dimc_DL_F
       assign  _COMPE =1'b0;
       assign  _FCSN  =_select_F;
-      assign  _MODE  = 2'b00;
+      assign  _MODE  = 4'b0000;
       assign  _FA    =spatz_req.op_cfg.dimc.sec;
       assign  _FD    =vrf_rdata_i[1];
       assign  _D     =0;
@@ -1357,7 +1467,7 @@ module spatz_vfu
     if (spatz_req.op_cfg.dimc.cmd == DIMC_CMD_LD_K) begin: gen_dimc_DL_K
       assign  _COMPE =1'b0;
       assign  _FCSN  =1'b1;
-      assign  _MODE  =2'b00;
+      assign  _MODE  =4'b0000;
       assign  _FA    ='x;
       assign  _FD    ='0;
       assign  _D     =vrf_rdata_i[1];
@@ -1372,14 +1482,66 @@ module spatz_vfu
       assign _M      =   '1;  // ? CRITICAL: Enable all bits for writing
       assign _MCT    = 8'h00;  // No masking for kernel load
     end: gen_dimc_DL_K
+    if (spatz_req.op_cfg.dimc.cmd == DIMC_CMD_LD_KB) begin: gen_dimc_DL_KB
+      assign  _COMPE =1'b0;
+      assign  _FCSN  =1'b1;
+      assign  _MODE  =4'b0000;
+      assign  _FA    ='x;
+      assign  _FD    ='0;
+      assign  _D     =vrf_rdata_i[1];
+      // Successive sections: sec wraps into the next kernel row
+      assign  _WA    =7'({spatz_req.op_cfg.dimc.k_row, spatz_req.op_cfg.dimc.sec} + dimc_ldk_count_q);
+      assign  _RCSN  =1'b1;
+      assign  _RCSN0 =1'b1;
+      assign  _RCSN1 =1'b1;
+      assign  _RCSN2 =1'b1;
+      assign  _RCSN3 =1'b1;
+      assign  _WCSN  =~(dimc_ldk_burst && vrf_rvalid_i[1]);
+      assign  _WEN   =~(dimc_ldk_burst && vrf_rvalid_i[1]);
+      assign _M      =   '1;
+      assign _MCT    = 8'h00;
+    end: gen_dimc_DL_KB
+    if (spatz_req.op_cfg.dimc.cmd == DIMC_CMD_LD_Q) begin: gen_dimc_LD_Q
+      assign  _COMPE =1'b0;
+      assign  _FCSN  =1'b1;
+      assign  _MODE  =4'b0000;
+      assign  _FA    ='x;
+      assign  _FD    ='0;
+      assign  _D     ='0;
+      assign  _WA    =7'b0;
+      assign  _RCSN  =1'b1;
+      assign  _RCSN0 =1'b1;
+      assign  _RCSN1 =1'b1;
+      assign  _RCSN2 =1'b1;
+      assign  _RCSN3 =1'b1;
+      assign  _WCSN  =1'b1;
+      assign  _WEN   =1'b1;
+    end: gen_dimc_LD_Q
+    if (spatz_req.op_cfg.dimc.cmd == DIMC_CMD_CFG) begin: gen_dimc_CFG
+      assign  _COMPE =1'b0;
+      assign  _FCSN  =1'b1;
+      assign  _MODE  =4'b0000;
+      assign  _FA    ='x;
+      assign  _FD    ='0;
+      assign  _D     ='0;
+      assign  _WA    =7'b0;
+      assign  _RCSN  =1'b1;
+      assign  _RCSN0 =1'b1;
+      assign  _RCSN1 =1'b1;
+      assign  _RCSN2 =1'b1;
+      assign  _RCSN3 =1'b1;
+      assign  _WCSN  =1'b1;
+      assign  _WEN   =1'b1;
+    end: gen_dimc_CFG
     if (spatz_req.op_cfg.dimc.cmd == DIMC_CMD_DPS) begin: gen_dimc_DPS
       assign  _COMPE = (comp_active && start_counter < 32) || compute_pulse;
-      assign  _MODE  = spatz_req.op_cfg.dimc.flags[1:0];
+      assign  _MODE  = {spatz_req.op_cfg.dimc.mode[5:4], spatz_req.op_cfg.dimc.flags[1:0]};  // {signedness, resolution}
       assign  _FA    = 'x;
       assign  _FD    = 'x;
-      assign  _ADDIN = comp_active ?  '0:operand1[23:0];
+      for (int m = 0; m < N_DIMC; m++)
+        _ADDIN[m] = comp_active ? '0 : operand1[m * 32 +: 24];
       assign  _D     = 256'b0;
-      assign  _RA    = comp_active ? {start_counter[4:0], spatz_req.op_cfg.dimc.sec} : 
+      assign  _RA    = comp_active ? {start_counter[4:0] + spatz_req.op_cfg.dimc.k_row, spatz_req.op_cfg.dimc.sec} : 
                                      {spatz_req.op_cfg.dimc.k_row, spatz_req.op_cfg.dimc.sec};
       assign  _WA    = 7'bxx;
       assign  _RCSN  = 1'b0;
@@ -1392,12 +1554,19 @@ module spatz_vfu
     end: gen_dimc_DPS
     if (spatz_req.op_cfg.dimc.cmd == DIMC_CMD_DSS) begin: gen_dimc_DSS
       assign  _COMPE = (comp_active && start_counter < 32) || compute_pulse;
-      assign  _MODE  = spatz_req.op_cfg.dimc.flags[1:0];
+      // A drain computes with all sections disabled in a multi-bit mode, so
+      // the dot product is zero and only the accumulators pass the output stage
+      assign  _MODE  = dimc_acc_drain ? 4'b0001 :
+                       {spatz_req.op_cfg.dimc.mode[5:4], spatz_req.op_cfg.dimc.flags[1:0]};  // {signedness, resolution}
       assign  _FA    = 'x;
       assign  _FD    = 'x;
-      assign  _ADDIN = comp_active ? dimc_buffer_psin_2[psin_buffer_idx * 32 +: 24]:(spatz_req.vs1[1] ? operand3[23:0] : 24'b0); //comp_active ?  '0:operand1[23:0]; //operand1[23:0] due to loop
+      // Macro m adds the partial sum of its own output channel
+      for (int m = 0; m < N_DIMC; m++)
+        _ADDIN[m] = dimc_acc_rd ? dimc_acc_q[5'(dimc_acc_idx_q + m)] :
+                    comp_active ? dimc_buffer_psin_2[3'(psin_buffer_idx + m) * 32 +: 24] :
+                                  (dimc_psin_en ? operand3[m * 32 +: 24] : 24'b0); //comp_active ?  '0:operand1[23:0]; //operand1[23:0] due to loop
       assign  _D     = 256'b0;
-      assign  _RA    = comp_active ? {start_counter[4:0], spatz_req.op_cfg.dimc.sec} : 
+      assign  _RA    = comp_active ? {start_counter[4:0] + spatz_req.op_cfg.dimc.k_row, spatz_req.op_cfg.dimc.sec} : 
                                      {spatz_req.op_cfg.dimc.k_row, spatz_req.op_cfg.dimc.sec};
       assign  _WA    = 7'bxx;
       assign  _RCSN  = 1'b0;
@@ -1410,12 +1579,12 @@ module spatz_vfu
     end: gen_dimc_DSS
     if (spatz_req.op_cfg.dimc.cmd == DIMC_CMD_MACVV) begin: gen_dimc_MACVV
       // Use funct7 for mode (from instruction decode)
-      assign  _MODE  = spatz_req.op_cfg.dimc.mode[1:0];  // funct7[1:0] for mode
+      assign  _MODE  = {spatz_req.op_cfg.dimc.mode[5:4], spatz_req.op_cfg.dimc.mode[1:0]};  // funct7[5:4] signedness, funct7[1:0] resolution
   
       if (macvv_state_d == MACVV_LOAD_FEATURE) begin
         assign  _COMPE =1'b0;
         assign  _FCSN  =_select_F;
-        assign  _MODE  = 2'b00;
+        assign  _MODE  = 4'b0000;
         assign  _FA    =macvv_feature_load_count[0]; //when VLEN of VRF 1024 [1:0] to fill all 4 sec
         assign  _FD    =vrf_rdata_i[1];
         assign  _D     =0;
@@ -1432,7 +1601,7 @@ module spatz_vfu
       else if (macvv_state_d == MACVV_LOAD_KERNEL) begin
         assign  _COMPE =1'b0;
         assign  _FCSN  =1'b1;
-        assign  _MODE  =2'b00;
+        assign  _MODE  =4'b0000;
         assign  _FA    ='x;
         assign  _FD    ='0;
         assign  _D     =vrf_rdata_i[0];
@@ -1450,10 +1619,11 @@ module spatz_vfu
       // Compute phase 
       else if (macvv_state_d ==  MACVV_COMPUTE) begin
         assign  _COMPE = (comp_active && start_counter < 8); //|| compute_pulse
-        assign  _MODE  = spatz_req.op_cfg.dimc.mode[1:0];
+        assign  _MODE  = {spatz_req.op_cfg.dimc.mode[5:4], spatz_req.op_cfg.dimc.mode[1:0]};
         assign  _FA    = 'x;
         assign  _FD    = 'x;
-        assign  _ADDIN = dimc_buffer_psin[psin_buffer_idx * 32 +: 24]; //operand1[23:0] due to loop comp_active ?  dimc_buffer_psin[psin_buffer_idx * 32 +: 24]:operand1[23:0]
+        for (int m = 0; m < N_DIMC; m++)
+          _ADDIN[m] = dimc_buffer_psin[psin_buffer_idx * 32 +: 24]; //operand1[23:0] due to loop comp_active ?  dimc_buffer_psin[psin_buffer_idx * 32 +: 24]:operand1[23:0]
         assign  _D     = 256'b0;
         assign  _RA    = {macvv_compute_counter[2:0],2'b00};  // row[2:0], sec=0                 
         assign  _WA    = 7'bxx;
@@ -1471,38 +1641,202 @@ module spatz_vfu
     end: gen_dimc_MACVV
   end:DIMC_DECODE
 
-  // DIMC instance
-  DIMC_18_fixed #(
-    .SECTION_WIDTH(SECTION_WIDTH)
-  ) i_dimc (
-    .RCK(clk_i),                                                    // Main clock
-    .RESETn(rst_ni),                                                // Active-low reset
-    .READYN(dimc_ready),                                            // Active-low ready (output valid)
-    .COMPE(_COMPE),                                                 // Operation mode (1=compute, 0=memory)
-    .FCSN(_FCSN),                                                   // Feature buffer chip select (active-low)
-    .MODE(_MODE),                                                   // Bit resolution (0=1b, 1=2b, 2=4b) spatz_req.mode we can aslo use it
-    .FA(_FA),                                                       // Feature buffer address we use 
-    .FD(_FD),                                                       // Feature buffer datas
-    .ADDIN(_ADDIN),                                                 // Bias/partial sum input
-    .SOUT(dimc_result_4bit[0]),                                     // Sum output (LSB of result)
-    .RES_OUT(dimc_result_4bit[3:1]),                                // Result output (MSBs of 4-bit result)
-    .PSOUT(dimc_psout),                                             // Pre-ReLU output
-    .Q(_Q),                                                         // Memory output (unused)
-    .D(_D),                                                         // Memory input (unused)
-    .RA(_RA),                                                       // Memory address (row address)
-    .WA(_WA),                                                       // Write address (when write command have provided)
-    .RCSN (_RCSN),                                                  // Read chip select (active-low)
-    .RCSN0(_RCSN0),                                                 // Computation control
-    .RCSN1(_RCSN1),                                                 // Computation control
-    .RCSN2(_RCSN2),                                                 // Computation control
-    .RCSN3(_RCSN3),                                                 // Computation control
-    .WCK(clk_i),                                                    // Write clock
-    .WCSN(_WCSN),                                                   // Write chip select (active-low)
-    .WEN(_WEN),                                                     // Write enable (active-low)
-    .M(_M),                                                         // Bitwise write mask (unused)
-    .MCT(_MCT)                                                        // Masking coding thermometric (unused)
-  );
-  
+  // Kernel memory writes from the DMA use the write port whenever the
+  // instruction stream (LD_K, LD_KB, MACVV) does not write it in this cycle.
+  // The kernel memory is banked, so they also proceed during a compute, unless
+  // the compute still has to read a row of the same bank: a DMV sweep holds
+  // back every bank between its current and its last row, so a layer never
+  // mixes old and new weights.
+  localparam int unsigned DIMCKernelBankRows = 32 / DIMC_KBANKS;
+
+  logic [31:0]            dimc_rows_pending;  // Rows the running compute still reads
+  logic [DIMC_KBANKS-1:0] dimc_kbank_busy;    // Banks holding such a row
+  logic         dimc_kwr_conflict;
+  logic         dimc_kwr_fire;
+  logic [255:0] dimc_D;
+  logic [6:0]   dimc_WA;
+  logic [2:0]   dimc_kernel_macro;
+  logic         dimc_WCSN;
+  logic         dimc_WEN;
+  logic [255:0] dimc_M;
+
+  always_comb begin
+    dimc_rows_pending = '0;
+    // A single DPS/DSS reads its row in this cycle only
+    if (_COMPE && !_RCSN)
+      dimc_rows_pending[_RA[6:2]] = 1'b1;
+    // A sweep reads DIMCLoopRows rows from k_row on: all of them when it
+    // starts, the ones from start_counter on while it runs
+    if (!macvv_instruction_active && (comp_active || (compute_pulse && dimc_loop_mode)))
+      for (int unsigned r = 0; r < DIMCLoopRows; r++)
+        if (!comp_active || r >= start_counter)
+          dimc_rows_pending[5'(spatz_req.op_cfg.dimc.k_row + r)] = 1'b1;
+    // MACVV loads and computes on rows 0-7 of macro 0
+    if (macvv_instruction_active)
+      dimc_rows_pending[7:0] = '1;
+  end
+
+  for (genvar b = 0; b < DIMC_KBANKS; b++) begin: gen_dimc_kbank_busy
+    assign dimc_kbank_busy[b] = |dimc_rows_pending[b * DIMCKernelBankRows +: DIMCKernelBankRows];
+  end: gen_dimc_kbank_busy
+
+  assign dimc_kwr_conflict = dimc_kbank_busy[dimc_kwr_i.addr[6:2] / DIMCKernelBankRows];
+  assign dimc_kwr_ready_o  = _WCSN && !dimc_kwr_conflict;
+  assign dimc_kwr_fire     = dimc_kwr_valid_i && dimc_kwr_ready_o;
+  assign dimc_D            = dimc_kwr_fire ? dimc_kwr_i.data  : _D;
+  assign dimc_WA           = dimc_kwr_fire ? dimc_kwr_i.addr  : 7'(_WA);
+  assign dimc_kernel_macro = dimc_kwr_fire ? dimc_kwr_i.macro : spatz_req.op_cfg.dimc.macro;
+  assign dimc_WCSN         = dimc_kwr_fire ? 1'b0 : _WCSN;
+  assign dimc_WEN          = dimc_kwr_fire ? 1'b0 : _WEN;
+  assign dimc_M            = dimc_kwr_fire ? '1   : _M;
+
+  // LD_Q loads the per-row requant table of one macro from vs1 and sets the
+  // output stage configuration shared by all macros
+  assign dimc_qtab_we = spatz_req_valid && is_dimc_insn && spatz_req.op_cfg.dimc.cmd == DIMC_CMD_LD_Q &&
+                        !spatz_req.op_cfg.dimc.flags[4];
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin
+    if (!rst_ni) begin
+      dimc_ocfg_q <= '0;
+      dimc_pack_q <= '0;
+    end else begin
+      if (spatz_req_valid && is_dimc_insn && spatz_req.op_cfg.dimc.cmd == DIMC_CMD_LD_Q)
+        dimc_ocfg_q <= spatz_req.op_cfg.dimc.flags[3:0];
+      // Latch the output width for the whole loop-mode sequence
+      if (compute_pulse && dimc_loop_mode && spatz_req.op_cfg.dimc.cmd inside {DIMC_CMD_DSS, DIMC_CMD_DPS})
+        dimc_pack_q <= dimc_ocfg_q[3:2];
+    end
+  end
+
+  // CFG writes the MCT register from the scalar rs1. The feature buffer
+  // writes track which sections hold only zeros: in the multi-bit modes they
+  // do not contribute to the dot product and are left out of the compute.
+  // In 1-bit XNOR mode a zero feature still matches zero kernel bits, so all
+  // sections stay enabled.
+  assign dimc_skip_sec = dimc_fzero_q & {4{_MODE[1:0] != 2'b00}};
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin
+    if (!rst_ni) begin
+      dimc_mct_q   <= '0;
+      dimc_fzero_q <= '1;
+    end else begin
+      if (spatz_req_valid && is_dimc_insn && spatz_req.op_cfg.dimc.cmd == DIMC_CMD_CFG &&
+          spatz_req.op_cfg.dimc.flags[4:1] == '0)
+        dimc_mct_q <= spatz_req.rs1[7:0];
+      if (!_FCSN)
+        dimc_fzero_q[_FA] <= ~|_FD;
+    end
+  end
+
+  // The accumulators are indexed like the DMV results: compute i of the sweep
+  // reads entries [i * N_DIMC, (i + 1) * N_DIMC), one per macro, and the
+  // results are written back in the same order as they return.
+  always_ff @(posedge clk_i or negedge rst_ni) begin
+    if (!rst_ni) begin
+      dimc_acc_q     <= '0;
+      dimc_acc_idx_q <= '0;
+    end else begin
+      if (spatz_req_valid && dimc_loop_mode && result_counter == 6'd32)
+        dimc_acc_idx_q <= '0;
+      else if (_COMPE && dimc_acc_rd)
+        dimc_acc_idx_q <= dimc_acc_idx_q + 5'(N_DIMC);
+
+      if (!dimc_ready && fifo_head_acc != 2'b00)
+        for (int m = 0; m < N_DIMC; m++)
+          dimc_acc_q[5'(result_counter + m)] <= (fifo_head_acc == 2'b01) ? dimc_psout_macro[m] : '0;
+    end
+  end
+
+  // DIMC macro array. All macros see the same feature buffer broadcast and
+  // compute on the same row address; each holds different kernel rows.
+  for (genvar m = 0; m < N_DIMC; m++) begin: gen_dimc
+    logic kernel_sel;   // LD_K targets this macro
+    logic compute_sel;  // Compute reads this macro
+
+    assign kernel_sel  = (dimc_macvv_active && !dimc_kwr_fire) ? (m == 0) :
+                         ((dimc_kernel_macro & 3'(N_DIMC - 1)) == 3'(m));
+    assign compute_sel = !dimc_macvv_active || (m == 0);
+
+    DIMC_18_fixed #(
+      .SECTION_WIDTH(SECTION_WIDTH),
+      .NUM_KBANKS   (DIMC_KBANKS  )
+    ) i_dimc (
+      .RCK(clk_i),                                                    // Main clock
+      .RESETn(rst_ni),                                                // Active-low reset
+      .READYN(dimc_ready_macro[m]),                                   // Active-low ready (output valid)
+      .COMPE(_COMPE),                                                 // Operation mode (1=compute, 0=memory)
+      .FCSN(_FCSN),                                                   // Feature buffer chip select (active-low)
+      .MODE(_MODE),                                                   // [1:0] bit resolution, [2] signed kernel, [3] signed feature
+      .FA(_FA),                                                       // Feature buffer address we use
+      .FD(_FD),                                                       // Feature buffer datas
+      .ADDIN(_ADDIN[m]),                                              // Bias/partial sum input
+      .SOUT(dimc_result_4bit_macro[m][0]),                            // Sum output (LSB of result)
+      .RES_OUT(dimc_result_4bit_macro[m][3:1]),                       // Result output (MSBs of 4-bit result)
+      .PSOUT(dimc_psout_macro[m]),                                    // Pre-ReLU output
+      .Q(),                                                           // Memory output (unused)
+      .D(dimc_D),                                                     // Memory input
+      .RA(_RA),                                                       // Memory address (row address)
+      .WA(dimc_WA),                                                   // Write address (when write command have provided)
+      .RCSN (_RCSN | ~compute_sel),                                   // Read chip select (active-low)
+      .RCSN0(_RCSN0 | dimc_skip_sec[0] | dimc_acc_drain),             // Section 0 compute enable (active-low)
+      .RCSN1(_RCSN1 | dimc_skip_sec[1] | dimc_acc_drain),             // Section 1 compute enable (active-low)
+      .RCSN2(_RCSN2 | dimc_skip_sec[2] | dimc_acc_drain),             // Section 2 compute enable (active-low)
+      .RCSN3(_RCSN3 | dimc_skip_sec[3] | dimc_acc_drain),             // Section 3 compute enable (active-low)
+      .WCK(clk_i),                                                    // Write clock
+      .WCSN(dimc_WCSN | ~kernel_sel),                                 // Write chip select (active-low)
+      .WEN(dimc_WEN | ~kernel_sel),                                   // Write enable (active-low)
+      .M(dimc_M),                                                     // Bitwise write mask
+      .MCT(dimc_macvv_active ? 8'h00 : dimc_mct_q),                   // Tail mask, 4 bits per step (set by CFG)
+      .OCFG((dimc_macvv_active || dimc_acc_keep) ? 4'b0000 : dimc_ocfg_q), // Output stage (raw sums for MACVV and accumulation)
+      .QCSN(~(dimc_qtab_we && (spatz_req.op_cfg.dimc.macro & 3'(N_DIMC - 1)) == 3'(m))), // Requant table write
+      .QA(spatz_req.op_cfg.dimc.k_row[4:3]),                          // Requant table group
+      .QD(vrf_rdata_i[1])                                             // Requant table entries
+    );
+
+    assign dimc_32bit_result[m] = {{8{dimc_psout_macro[m][23]}}, dimc_psout_macro[m]}; // signed-extend to 32-bit
+  end: gen_dimc
+
+  // All macros share one pipeline schedule, macro 0 drives the handshake
+  assign dimc_ready       = dimc_ready_macro[0];
+  assign dimc_psout       = dimc_psout_macro[0];
+  assign dimc_result_4bit = dimc_result_4bit_macro[0];
+  assign _Q               = '0;
+
+  //-----------------
+  // Perf events
+  //-----------------
+
+  assign dimc_events_o.compute     = _COMPE;
+  assign dimc_events_o.ld_f        = ~_FCSN;
+  assign dimc_events_o.ld_k        = ~dimc_WCSN;
+  // Results in flight, but neither a new compute nor a result this cycle
+  assign dimc_events_o.stall_ready = state_q == VFU_RunningDIMC && dimc_fifo_count > 0 &&
+                                     dimc_ready && !_COMPE;
+  // A compute held back until a result leaves the FIFO
+  assign dimc_events_o.stall_fifo  = spatz_req_valid && is_dimc_insn && dimc_fifo_full &&
+                                     (spatz_req.op_cfg.dimc.cmd inside {DIMC_CMD_DSS, DIMC_CMD_DPS} ||
+                                      (spatz_req.op_cfg.dimc.cmd == DIMC_CMD_MACVV && macvv_state_q == MACVV_IDLE));
+  assign dimc_events_o.wb_conflict = dimc_write_active && vreg_we && !vrf_wvalid_i;
+
+  //-----------------
+  // Burst LD_K
+  //-----------------
+
+  assign dimc_ldk_burst      = spatz_req_valid && is_dimc_insn && spatz_req.op_cfg.dimc.cmd == DIMC_CMD_LD_KB;
+  assign dimc_ldk_burst_done = dimc_ldk_burst && vrf_rvalid_i[1] &&
+                               dimc_ldk_count_q == spatz_req.op_cfg.dimc.flags;
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin
+    if (!rst_ni) begin
+      dimc_ldk_count_q <= '0;
+    end else begin
+      if (dimc_ldk_burst_done)
+        dimc_ldk_count_q <= '0;
+      else if (dimc_ldk_burst && vrf_rvalid_i[1])
+        dimc_ldk_count_q <= dimc_ldk_count_q + 1;
+    end
+  end
+
   //--------------
   // MACVV FSM IME
   //--------------
@@ -1553,7 +1887,7 @@ module spatz_vfu
     if (spatz_req.op_cfg.dimc.cmd == DIMC_CMD_MACVV || macvv_instruction_active) begin //spatz_req_valid && spatz_req.op_cfg.dimc.cmd == DIMC_CMD_MACVV
       unique case (macvv_state_q)
         MACVV_IDLE: begin
-          if (operands_ready) begin
+          if (operands_ready && !dimc_fifo_full) begin
            macvv_state_d = MACVV_LOAD_FEATURE;
           end
         end
@@ -1599,13 +1933,13 @@ module spatz_vfu
 
   assign dimc_in_ready = {N_FU*ELENB{~dimc_ready}};
   assign dimc_result_valid = {N_FU*ELENB{~dimc_ready}};
-  assign dimc_32bit_result = {{8{dimc_psout[23]}}, dimc_psout}; // signed-extend to 32-bit
 
   always_comb begin
     dimc_result_wide = '0;
     // Place 32-bit result at element position specified by instruction
     // FIX: Always use dimc_element_sel for positioning
-    dimc_result_wide[dimc_element_sel * 32 +: 32] = dimc_32bit_result;
+    for (int m = 0; m < N_DIMC; m++)
+      dimc_result_wide[3'(dimc_element_sel + m) * 32 +: 32] = dimc_32bit_result[m];
   end
 
   assign dimc_result = dimc_result_wide;
@@ -1613,6 +1947,7 @@ module spatz_vfu
   // DIMC busy signal
   assign is_dimc_busy = (state_q == VFU_RunningDIMC) && (~dimc_ready ||             // DIMC computing we change q to d
                       dimc_loop_active ||        // Loop mode active
+                      (dimc_ldk_burst && !dimc_ldk_burst_done) || // Burst LD_K streaming
                       macvv_loading_active ||    // MACVV loading macvv_instruction_active reset
                       macvv_state_q != MACVV_IDLE); // Any MACVV state; IME
 
@@ -1628,7 +1963,8 @@ module spatz_vfu
       if (dimc_loop_active) begin
   
         base_addr = dimc_tag_fifo[dimc_fifo_head].vd_addr;
-        chunk_offset = vrf_chunk_idx << $clog2(NrWordsPerVector);
+        // Packed outputs all go to the first word of vd
+        chunk_offset = (dimc_pack_q != 2'b00) ? '0 : vrf_chunk_idx << $clog2(NrWordsPerVector);
         dimc_result_tag.vd_addr = base_addr + chunk_offset/2;    
  
       end
@@ -1703,10 +2039,10 @@ module spatz_vfu
           dimc_fifo_count <= dimc_fifo_count + 1;
         end
       end
-      // MACVV instruction arrival
+      // MACVV start, only once the FIFO has room to track it
       else if (spatz_req_valid && spatz_req.op_cfg.dimc.cmd == DIMC_CMD_MACVV && 
-               !running_q[spatz_req.id]) begin
-        // Push MACVV to FIFO immediately (like DSS/DPS)
+               macvv_state_q == MACVV_IDLE && macvv_state_d == MACVV_LOAD_FEATURE) begin
+        // Push MACVV to FIFO (like DSS/DPS)
         if (dimc_fifo_count < 4) begin
           // Store as loop mode (bit 8 = 1) because MACVV has multiple phases
           dimc_vd_fifo[dimc_fifo_tail] <= {1'b1, spatz_req.op_cfg.dimc.flags[4:2], spatz_req.vd};
@@ -1743,8 +2079,8 @@ module spatz_vfu
               psin_buffer_idx <= psin_buffer_idx + 1; 
           end 
       end else begin
-          // DSS/DPS: 32 computations  
-          if (start_counter < 31) begin
+          // DSS/DPS: 32 results over DIMCLoopRows computations
+          if (start_counter < DIMCLoopRows - 1) begin
               start_counter <= start_counter + 1;
             //  psin_buffer_idx <= psin_buffer_idx + 1; //U
           end else begin
@@ -1756,23 +2092,23 @@ module spatz_vfu
     if (compute_pulse && spatz_req.op_cfg.dimc.cmd inside {DIMC_CMD_DSS, DIMC_CMD_DPS}) begin
       // MACVV uses 8 computations (0-7), others use 32 (0-31)
       if (dimc_loop_mode) begin
-          // DSS/DPS: 32 computations  
-          if (start_counter < 31) begin
-              psin_buffer_idx <= psin_buffer_idx + 1; //U
+          // DSS/DPS: 32 results over DIMCLoopRows computations
+          if (start_counter < DIMCLoopRows - 1) begin
+              psin_buffer_idx <= psin_buffer_idx + N_DIMC; //U
           end
 
           if (!comp_active && psin_buffer_idx == 3'b000) begin
             psin_write <= 1'b1;
-          end else if(start_counter < 8 && psin_buffer_idx == 3'b111) begin
+          end else if(start_counter < DIMCRowsPerChunk && psin_buffer_idx == 3'(8 - N_DIMC)) begin
             psin_chunk_idx <= psin_chunk_idx + 1;
             psin_write <= 1'b1;
-          end else if (start_counter < 16 && psin_buffer_idx == 3'b111) begin
+          end else if (start_counter < 2 * DIMCRowsPerChunk && psin_buffer_idx == 3'(8 - N_DIMC)) begin
             psin_chunk_idx <= psin_chunk_idx + 2;
             psin_write <= 1'b1;
-          end else if (start_counter < 24 && psin_buffer_idx == 3'b111) begin
+          end else if (start_counter < 3 * DIMCRowsPerChunk && psin_buffer_idx == 3'(8 - N_DIMC)) begin
             psin_chunk_idx <= psin_chunk_idx + 3;
             psin_write <= 1'b1;
-          end else if (start_counter < 32 && psin_buffer_idx == 3'b111) begin
+          end else if (start_counter < 4 * DIMCRowsPerChunk && psin_buffer_idx == 3'(8 - N_DIMC)) begin
             psin_chunk_idx <= psin_chunk_idx + 4;
             psin_write <= 1'b1;
           end 
@@ -1781,10 +2117,12 @@ module spatz_vfu
     
       // ===== RESULT PROCESSING =====
       if (!dimc_ready && fifo_head_is_loop) begin //added after dimc_loop_active && start_counter > 3'd2
-        // Store each 32-bit result in buffer
-        dimc_buffer[{buffer_idx, 5'b0} +: 32] <= dimc_32bit_result;
-        buffer_idx <= buffer_idx + 1;
-        result_counter <= result_counter + 1;
+        // Store each 32-bit result in buffer, one per active macro
+        for (int m = 0; m < N_DIMC; m++)
+          if (m < dimc_results_per_beat)
+            dimc_buffer[{3'(buffer_idx + m), 5'b0} +: 32] <= dimc_32bit_result[m];
+        buffer_idx <= buffer_idx + dimc_results_per_beat;
+        result_counter <= result_counter + dimc_results_per_beat;
         
           // Check if all 32 results received
           // Check if all results received
@@ -1823,8 +2161,9 @@ module spatz_vfu
       // ===== BURST WRITE TRIGGER =====
       // Trigger after every 8th result (cycles 11, 19, 27, 35)
       burst_write <= 1'b0;
-      if (!dimc_ready && dimc_loop_active && result_counter[2:0] == 3'b111) begin
-        burst_write <= 1'b1;
+      if (!dimc_ready && dimc_loop_active && result_counter[2:0] == 3'(8 - dimc_results_per_beat)) begin
+        // Results kept in the accumulators are not written back
+        burst_write <= fifo_head_acc != 2'b01;
         buffer_idx <= 1'b0; //8 result buffer 
         vrf_chunk_idx <= result_counter[4:3];  // Which chunk (0-3)
       end
@@ -113,7 +113,11 @@ module spatz_cc
     output dma_events_t                  axi_dma_events_o,
     // Core event strobes
     output core_events_t                 core_events_o,
-    input  addr_t                        tcdm_addr_base_i
+    input  addr_t                        tcdm_addr_base_i,
+    // DIMC kernel memory write port
+    input  spatz_pkg::dimc_kwr_t         dimc_kwr_i,
+    input  logic                         dimc_kwr_valid_i,
+    output logic                         dimc_kwr_ready_o
   );
 
   // FMA architecture is "merged" -> mulexp and macexp instructions are supported
@@ -146,6 +150,7 @@ module spatz_cc
   fpnew_pkg::status_t fpu_status;
 
   core_events_t snitch_events;
+  spatz_pkg::dimc_events_t dimc_events;
 
   // Snitch Integer Core
   dreq_t snitch_dreq_d, snitch_dreq_q, merged_dreq;
@@ -312,7 +317,11 @@ module spatz_cc
     .fp_lsu_mem_rsp_i        (fp_lsu_mem_rsp        ),
     .fpu_rnd_mode_i          (fpu_rnd_mode          ),
     .fpu_fmt_mode_i          (fpu_fmt_mode          ),
-    .fpu_status_o            (fpu_status            )
+    .fpu_status_o            (fpu_status            ),
+    .dimc_kwr_i              (dimc_kwr_i            ),
+    .dimc_kwr_valid_i        (dimc_kwr_valid_i      ),
+    .dimc_kwr_ready_o        (dimc_kwr_ready_o      ),
+    .dimc_events_o           (dimc_events           )
   );
 
   for (genvar p = 0; p < NumMemPortsPerSpatz; p++) begin: gen_tcdm_assignment
@@ -471,6 +480,12 @@ module spatz_cc
   assign core_events_o.issue_fpu         = '0;
   assign core_events_o.issue_core_to_fpu = '0;
   assign core_events_o.issue_fpu_seq     = '0;
+  assign core_events_o.dimc_compute      = dimc_events.compute;
+  assign core_events_o.dimc_ld_f         = dimc_events.ld_f;
+  assign core_events_o.dimc_ld_k         = dimc_events.ld_k;
+  assign core_events_o.dimc_stall_ready  = dimc_events.stall_ready;
+  assign core_events_o.dimc_stall_fifo   = dimc_events.stall_fifo;
+  assign core_events_o.dimc_wb_conflict  = dimc_events.wb_conflict;
 
   // --------------------------
   // Tracer
@@ -252,7 +252,12 @@ module spatz_mempool_cc
     .fp_lsu_mem_rsp_ready_o  ( fp_lsu_mem_rsp_ready  ),
     .fpu_rnd_mode_i          ( fpu_rnd_mode          ),
     .fpu_fmt_mode_i          ( fpu_fmt_mode          ),
-    .fpu_status_o            ( fpu_status            )
+    .fpu_status_o            ( fpu_status            ),
+    // No DMA path to the DIMC kernel memory in MemPool
+    .dimc_kwr_i              ( '0                    ),
+    .dimc_kwr_valid_i        ( 1'b0                  ),
+    .dimc_kwr_ready_o        ( /* Unused */          ),
+    .dimc_events_o           ( /* Unused */          )
   );
 
   // TODO: Perhaps put it into a module
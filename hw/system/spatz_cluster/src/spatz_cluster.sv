@@ -186,7 +186,7 @@ module spatz_cluster
   localparam int unsigned WideIdWidthOut = AxiIdWidthOut;
   localparam int unsigned WideIdWidthIn  = WideIdWidthOut - $clog2(NrWideMasters);
   // DMA X-BAR configuration
-  localparam int unsigned NrWideSlaves   = 3;
+  localparam int unsigned NrWideSlaves   = 4;
 
   // AXI Configuration
   localparam axi_pkg::xbar_cfg_t ClusterXbarCfg = '{
@@ -218,7 +218,7 @@ module spatz_cluster
     UniqueIds         : 1'b0,
     AxiAddrWidth      : AxiAddrWidth,
     AxiDataWidth      : AxiDataWidth,
-    NoAddrRules       : 2,
+    NoAddrRules       : 3,
     default           : '0
   };
 
@@ -361,6 +361,12 @@ module spatz_cluster
   assign cluster_periph_start_address = tcdm_end_address;
   assign cluster_periph_end_address   = tcdm_end_address + ClusterPeriphSize * 1024;
 
+  // DIMC kernel memory window (DMA only), 32 KiB per core after the peripherals
+  localparam int unsigned DIMCWindowSize = NrCores * 32 * 1024;
+  addr_t dimc_start_address, dimc_end_address;
+  assign dimc_start_address = cluster_periph_end_address;
+  assign dimc_end_address   = cluster_periph_end_address + DIMCWindowSize;
+
   // ----------------
   // Wire Definitions
   // ----------------
@@ -469,6 +475,11 @@ module spatz_cluster
       idx       : BootROM,
       start_addr: BootAddr,
       end_addr  : BootAddr + 'h1000
+    },
+    '{
+      idx       : DIMCDMA,
+      start_addr: dimc_start_address,
+      end_addr  : dimc_end_address
     }
   };
 
@@ -555,6 +566,31 @@ module spatz_cluster
     .mem_rsp_i (sb_dma_rsp )
   );
 
+  // -----------------------
+  // DIMC Kernel Memory Port
+  // -----------------------
+
+  spatz_pkg::dimc_kwr_t               dimc_kwr;
+  logic                 [NrCores-1:0] dimc_kwr_valid, dimc_kwr_ready;
+
+  spatz_dimc_loader #(
+    .NrCores      (NrCores           ),
+    .AxiAddrWidth (AxiAddrWidth      ),
+    .AxiDataWidth (AxiDataWidth      ),
+    .AxiIdWidth   (WideIdWidthOut    ),
+    .axi_req_t    (axi_slv_dma_req_t ),
+    .axi_resp_t   (axi_slv_dma_resp_t)
+  ) i_dimc_loader (
+    .clk_i                (clk_i                    ),
+    .rst_ni               (rst_ni                   ),
+    .axi_req_i            (wide_axi_slv_req[DIMCDMA]),
+    .axi_resp_o           (wide_axi_slv_rsp[DIMCDMA]),
+    .dimc_start_address_i (dimc_start_address       ),
+    .dimc_kwr_o           (dimc_kwr                 ),
+    .dimc_kwr_valid_o     (dimc_kwr_valid           ),
+    .dimc_kwr_ready_i     (dimc_kwr_ready           )
+  );
+
   // ----------------
   // Memory Subsystem
   // ----------------
@@ -767,7 +803,10 @@ module spatz_cluster
       .axi_dma_perf_o   (/* Unused */                        ),
       .axi_dma_events_o (dma_core_events                     ),
       .core_events_o    (core_events[i]                      ),
-      .tcdm_addr_base_i (tcdm_start_address                  )
+      .tcdm_addr_base_i (tcdm_start_address                  ),
+      .dimc_kwr_i       (dimc_kwr                            ),
+      .dimc_kwr_valid_i (dimc_kwr_valid[i]                   ),
+      .dimc_kwr_ready_o (dimc_kwr_ready[i]                   )
     );
     for (genvar j = 0; j < TcdmPorts; j++) begin : gen_tcdm_user
       always_comb begin
@@ -234,6 +234,18 @@ module spatz_cluster_peripheral
         perf_counter_d[i] = perf_counter_d[i] +
               icache_events_q[reg2hw.hart_select[i].q].l0_stall;
       end
+      // DIMC event selected in DIMC_EVENT_SELECT
+      else if (reg2hw.perf_counter_enable[i].dimc.q) begin
+        unique case (reg2hw.dimc_event_select[i].q)
+          3'd0: perf_counter_d[i] = perf_counter_d[i] + sel_core_events.dimc_compute;
+          3'd1: perf_counter_d[i] = perf_counter_d[i] + sel_core_events.dimc_ld_f;
+          3'd2: perf_counter_d[i] = perf_counter_d[i] + sel_core_events.dimc_ld_k;
+          3'd3: perf_counter_d[i] = perf_counter_d[i] + sel_core_events.dimc_stall_ready;
+          3'd4: perf_counter_d[i] = perf_counter_d[i] + sel_core_events.dimc_stall_fifo;
+          3'd5: perf_counter_d[i] = perf_counter_d[i] + sel_core_events.dimc_wb_conflict;
+          default:;
+        endcase
+      end
       // Reset performance counter.
       if (reg2hw.perf_counter[i].qe) begin
         perf_counter_d[i] = reg2hw.perf_counter[i].q;
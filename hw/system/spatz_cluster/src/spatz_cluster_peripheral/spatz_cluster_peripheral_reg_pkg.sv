@@ -110,6 +110,9 @@ package spatz_cluster_peripheral_reg_pkg;
     struct packed {
       logic        q;
     } icache_stall;
+    struct packed {
+      logic        q;
+    } dimc;
   } spatz_cluster_peripheral_reg2hw_perf_counter_enable_mreg_t;
 
   typedef struct packed {
@@ -151,6 +154,10 @@ package spatz_cluster_peripheral_reg_pkg;
     logic [31:0] q;
   } spatz_cluster_peripheral_reg2hw_cluster_eoc_exit_reg_t;
 
+  typedef struct packed {
+    logic [2:0]  q;
+  } spatz_cluster_peripheral_reg2hw_dimc_event_select_mreg_t;
+
   typedef struct packed {
     logic [47:0] d;
   } spatz_cluster_peripheral_hw2reg_perf_counter_mreg_t;
@@ -161,16 +168,17 @@ package spatz_cluster_peripheral_reg_pkg;
 
   // Register -> HW type
   typedef struct packed {
-    spatz_cluster_peripheral_reg2hw_perf_counter_enable_mreg_t [1:0] perf_counter_enable; // [343:282]
-    spatz_cluster_peripheral_reg2hw_hart_select_mreg_t [1:0] hart_select; // [281:262]
-    spatz_cluster_peripheral_reg2hw_perf_counter_mreg_t [1:0] perf_counter; // [261:164]
-    spatz_cluster_peripheral_reg2hw_cl_clint_set_reg_t cl_clint_set; // [163:131]
-    spatz_cluster_peripheral_reg2hw_cl_clint_clear_reg_t cl_clint_clear; // [130:98]
-    spatz_cluster_peripheral_reg2hw_hw_barrier_reg_t hw_barrier; // [97:66]
-    spatz_cluster_peripheral_reg2hw_icache_prefetch_enable_reg_t icache_prefetch_enable; // [65:65]
-    spatz_cluster_peripheral_reg2hw_spatz_status_reg_t spatz_status; // [64:64]
-    spatz_cluster_peripheral_reg2hw_cluster_boot_control_reg_t cluster_boot_control; // [63:32]
-    spatz_cluster_peripheral_reg2hw_cluster_eoc_exit_reg_t cluster_eoc_exit; // [31:0]
+    spatz_cluster_peripheral_reg2hw_perf_counter_enable_mreg_t [1:0] perf_counter_enable; // [351:288]
+    spatz_cluster_peripheral_reg2hw_hart_select_mreg_t [1:0] hart_select; // [287:268]
+    spatz_cluster_peripheral_reg2hw_perf_counter_mreg_t [1:0] perf_counter; // [267:170]
+    spatz_cluster_peripheral_reg2hw_cl_clint_set_reg_t cl_clint_set; // [169:137]
+    spatz_cluster_peripheral_reg2hw_cl_clint_clear_reg_t cl_clint_clear; // [136:104]
+    spatz_cluster_peripheral_reg2hw_hw_barrier_reg_t hw_barrier; // [103:72]
+    spatz_cluster_peripheral_reg2hw_icache_prefetch_enable_reg_t icache_prefetch_enable; // [71:71]
+    spatz_cluster_peripheral_reg2hw_spatz_status_reg_t spatz_status; // [70:70]
+    spatz_cluster_peripheral_reg2hw_cluster_boot_control_reg_t cluster_boot_control; // [69:38]
+    spatz_cluster_peripheral_reg2hw_cluster_eoc_exit_reg_t cluster_eoc_exit; // [37:6]
+    spatz_cluster_peripheral_reg2hw_dimc_event_select_mreg_t [1:0] dimc_event_select; // [5:0]
   } spatz_cluster_peripheral_reg2hw_t;
 
   // HW -> register type
@@ -193,6 +201,8 @@ package spatz_cluster_peripheral_reg_pkg;
   parameter logic [BlockAw-1:0] SPATZ_CLUSTER_PERIPHERAL_SPATZ_STATUS_OFFSET = 7'h 50;
   parameter logic [BlockAw-1:0] SPATZ_CLUSTER_PERIPHERAL_CLUSTER_BOOT_CONTROL_OFFSET = 7'h 58;
   parameter logic [BlockAw-1:0] SPATZ_CLUSTER_PERIPHERAL_CLUSTER_EOC_EXIT_OFFSET = 7'h 60;
+  parameter logic [BlockAw-1:0] SPATZ_CLUSTER_PERIPHERAL_DIMC_EVENT_SELECT_0_OFFSET = 7'h 68;
+  parameter logic [BlockAw-1:0] SPATZ_CLUSTER_PERIPHERAL_DIMC_EVENT_SELECT_1_OFFSET = 7'h 70;
 
   // Reset values for hwext registers and their fields
   parameter logic [47:0] SPATZ_CLUSTER_PERIPHERAL_PERF_COUNTER_0_RESVAL = 48'h 0;
@@ -215,11 +225,13 @@ package spatz_cluster_peripheral_reg_pkg;
     SPATZ_CLUSTER_PERIPHERAL_ICACHE_PREFETCH_ENABLE,
     SPATZ_CLUSTER_PERIPHERAL_SPATZ_STATUS,
     SPATZ_CLUSTER_PERIPHERAL_CLUSTER_BOOT_CONTROL,
-    SPATZ_CLUSTER_PERIPHERAL_CLUSTER_EOC_EXIT
+    SPATZ_CLUSTER_PERIPHERAL_CLUSTER_EOC_EXIT,
+    SPATZ_CLUSTER_PERIPHERAL_DIMC_EVENT_SELECT_0,
+    SPATZ_CLUSTER_PERIPHERAL_DIMC_EVENT_SELECT_1
   } spatz_cluster_peripheral_id_e;
 
   // Register width information to check illegal writes
-  parameter logic [3:0] SPATZ_CLUSTER_PERIPHERAL_PERMIT [13] = '{
+  parameter logic [3:0] SPATZ_CLUSTER_PERIPHERAL_PERMIT [15] = '{
     4'b 1111, // index[ 0] SPATZ_CLUSTER_PERIPHERAL_PERF_COUNTER_ENABLE_0
     4'b 1111, // index[ 1] SPATZ_CLUSTER_PERIPHERAL_PERF_COUNTER_ENABLE_1
     4'b 0011, // index[ 2] SPATZ_CLUSTER_PERIPHERAL_HART_SELECT_0
@@ -232,7 +244,9 @@ package spatz_cluster_peripheral_reg_pkg;
     4'b 0001, // index[ 9] SPATZ_CLUSTER_PERIPHERAL_ICACHE_PREFETCH_ENABLE
     4'b 0001, // index[10] SPATZ_CLUSTER_PERIPHERAL_SPATZ_STATUS
     4'b 1111, // index[11] SPATZ_CLUSTER_PERIPHERAL_CLUSTER_BOOT_CONTROL
-    4'b 1111  // index[12] SPATZ_CLUSTER_PERIPHERAL_CLUSTER_EOC_EXIT
+    4'b 1111, // index[12] SPATZ_CLUSTER_PERIPHERAL_CLUSTER_EOC_EXIT
+    4'b 0001, // index[13] SPATZ_CLUSTER_PERIPHERAL_DIMC_EVENT_SELECT_0
+    4'b 0001  // index[14] SPATZ_CLUSTER_PERIPHERAL_DIMC_EVENT_SELECT_1
   };
 
 endpackage
@@ -161,6 +161,9 @@ module spatz_cluster_peripheral_reg_top #(
   logic perf_counter_enable_0_icache_stall_0_qs;
   logic perf_counter_enable_0_icache_stall_0_wd;
   logic perf_counter_enable_0_icache_stall_0_we;
+  logic perf_counter_enable_0_dimc_0_qs;
+  logic perf_counter_enable_0_dimc_0_wd;
+  logic perf_counter_enable_0_dimc_0_we;
   logic perf_counter_enable_1_cycle_1_qs;
   logic perf_counter_enable_1_cycle_1_wd;
   logic perf_counter_enable_1_cycle_1_we;
@@ -254,6 +257,9 @@ module spatz_cluster_peripheral_reg_top #(
   logic perf_counter_enable_1_icache_stall_1_qs;
   logic perf_counter_enable_1_icache_stall_1_wd;
   logic perf_counter_enable_1_icache_stall_1_we;
+  logic perf_counter_enable_1_dimc_1_qs;
+  logic perf_counter_enable_1_dimc_1_wd;
+  logic perf_counter_enable_1_dimc_1_we;
   logic [9:0] hart_select_0_qs;
   logic [9:0] hart_select_0_wd;
   logic hart_select_0_we;
@@ -284,6 +290,12 @@ module spatz_cluster_peripheral_reg_top #(
   logic [31:0] cluster_eoc_exit_qs;
   logic [31:0] cluster_eoc_exit_wd;
   logic cluster_eoc_exit_we;
+  logic [2:0] dimc_event_select_0_qs;
+  logic [2:0] dimc_event_select_0_wd;
+  logic dimc_event_select_0_we;
+  logic [2:0] dimc_event_select_1_qs;
+  logic [2:0] dimc_event_select_1_wd;
+  logic dimc_event_select_1_we;
 
   // Register instances
 
@@ -1096,6 +1108,32 @@ module spatz_cluster_peripheral_reg_top #(
   );
 
 
+  // F[dimc_0]: 31:31
+  prim_subreg #(
+    .DW      (1),
+    .SWACCESS("RW"),
+    .RESVAL  (1'h0)
+  ) u_perf_counter_enable_0_dimc_0 (
+    .clk_i   (clk_i    ),
+    .rst_ni  (rst_ni  ),
+
+    // from register interface
+    .we     (perf_counter_enable_0_dimc_0_we),
+    .wd     (perf_counter_enable_0_dimc_0_wd),
+
+    // from internal hardware
+    .de     (1'b0),
+    .d      ('0  ),
+
+    // to internal hardware
+    .qe     (),
+    .q      (reg2hw.perf_counter_enable[0].dimc.q ),
+
+    // to register interface (read)
+    .qs     (perf_counter_enable_0_dimc_0_qs)
+  );
+
+
   // Subregister 1 of Multireg perf_counter_enable
   // R[perf_counter_enable_1]: V(False)
 
@@ -1905,6 +1943,32 @@ module spatz_cluster_peripheral_reg_top #(
   );
 
 
+  // F[dimc_1]: 31:31
+  prim_subreg #(
+    .DW      (1),
+    .SWACCESS("RW"),
+    .RESVAL  (1'h0)
+  ) u_perf_counter_enable_1_dimc_1 (
+    .clk_i   (clk_i    ),
+    .rst_ni  (rst_ni  ),
+
+    // from register interface
+    .we     (perf_counter_enable_1_dimc_1_we),
+    .wd     (perf_counter_enable_1_dimc_1_wd),
+
+    // from internal hardware
+    .de     (1'b0),
+    .d      ('0  ),
+
+    // to internal hardware
+    .qe     (),
+    .q      (reg2hw.perf_counter_enable[1].dimc.q ),
+
+    // to register interface (read)
+    .qs     (perf_counter_enable_1_dimc_1_qs)
+  );
+
+
 
 
   // Subregister 0 of Multireg hart_select
@@ -2150,9 +2214,63 @@ module spatz_cluster_peripheral_reg_top #(
   );
 
 
+  // Subregister 0 of Multireg dimc_event_select
+  // R[dimc_event_select_0]: V(False)
+
+  prim_subreg #(
+    .DW      (3),
+    .SWACCESS("RW"),
+    .RESVAL  (3'h0)
+  ) u_dimc_event_select_0 (
+    .clk_i   (clk_i    ),
+    .rst_ni  (rst_ni  ),
+
+    // from register interface
+    .we     (dimc_event_select_0_we),
+    .wd     (dimc_event_select_0_wd),
+
+    // from internal hardware
+    .de     (1'b0),
+    .d      ('0  ),
+
+    // to internal hardware
+    .qe     (),
+    .q      (reg2hw.dimc_event_select[0].q ),
+
+    // to register interface (read)
+    .qs     (dimc_event_select_0_qs)
+  );
+
+  // Subregister 1 of Multireg dimc_event_select
+  // R[dimc_event_select_1]: V(False)
+
+  prim_subreg #(
+    .DW      (3),
+    .SWACCESS("RW"),
+    .RESVAL  (3'h0)
+  ) u_dimc_event_select_1 (
+    .clk_i   (clk_i    ),
+    .rst_ni  (rst_ni  ),
+
+    // from register interface
+    .we     (dimc_event_select_1_we),
+    .wd     (dimc_event_select_1_wd),
+
+    // from internal hardware
+    .de     (1'b0),
+    .d      ('0  ),
 
+    // to internal hardware
+    .qe     (),
+    .q      (reg2hw.dimc_event_select[1].q ),
+
+    // to register interface (read)
+    .qs     (dimc_event_select_1_qs)
+  );
 
-  logic [12:0] addr_hit;
+
+
+  logic [14:0] addr_hit;
   always_comb begin
     addr_hit = '0;
     addr_hit[ 0] = (reg_addr == SPATZ_CLUSTER_PERIPHERAL_PERF_COUNTER_ENABLE_0_OFFSET);
@@ -2168,6 +2286,8 @@ module spatz_cluster_peripheral_reg_top #(
     addr_hit[10] = (reg_addr == SPATZ_CLUSTER_PERIPHERAL_SPATZ_STATUS_OFFSET);
     addr_hit[11] = (reg_addr == SPATZ_CLUSTER_PERIPHERAL_CLUSTER_BOOT_CONTROL_OFFSET);
     addr_hit[12] = (reg_addr == SPATZ_CLUSTER_PERIPHERAL_CLUSTER_EOC_EXIT_OFFSET);
+    addr_hit[13] = (reg_addr == SPATZ_CLUSTER_PERIPHERAL_DIMC_EVENT_SELECT_0_OFFSET);
+    addr_hit[14] = (reg_addr == SPATZ_CLUSTER_PERIPHERAL_DIMC_EVENT_SELECT_1_OFFSET);
   end
 
   assign addrmiss = (reg_re || reg_we) ? ~|addr_hit : 1'b0 ;
@@ -2187,7 +2307,9 @@ module spatz_cluster_peripheral_reg_top #(
                (addr_hit[ 9] & (|(SPATZ_CLUSTER_PERIPHERAL_PERMIT[ 9] & ~reg_be))) |
                (addr_hit[10] & (|(SPATZ_CLUSTER_PERIPHERAL_PERMIT[10] & ~reg_be))) |
                (addr_hit[11] & (|(SPATZ_CLUSTER_PERIPHERAL_PERMIT[11] & ~reg_be))) |
-               (addr_hit[12] & (|(SPATZ_CLUSTER_PERIPHERAL_PERMIT[12] & ~reg_be)))));
+               (addr_hit[12] & (|(SPATZ_CLUSTER_PERIPHERAL_PERMIT[12] & ~reg_be))) |
+               (addr_hit[13] & (|(SPATZ_CLUSTER_PERIPHERAL_PERMIT[13] & ~reg_be))) |
+               (addr_hit[14] & (|(SPATZ_CLUSTER_PERIPHERAL_PERMIT[14] & ~reg_be)))));
   end
 
   assign perf_counter_enable_0_cycle_0_we = addr_hit[0] & reg_we & !reg_error;
@@ -2283,6 +2405,9 @@ module spatz_cluster_peripheral_reg_top #(
   assign perf_counter_enable_0_icache_stall_0_we = addr_hit[0] & reg_we & !reg_error;
   assign perf_counter_enable_0_icache_stall_0_wd = reg_wdata[30];
 
+  assign perf_counter_enable_0_dimc_0_we = addr_hit[0] & reg_we & !reg_error;
+  assign perf_counter_enable_0_dimc_0_wd = reg_wdata[31];
+
   assign perf_counter_enable_1_cycle_1_we = addr_hit[1] & reg_we & !reg_error;
   assign perf_counter_enable_1_cycle_1_wd = reg_wdata[0];
 
@@ -2376,6 +2501,9 @@ module spatz_cluster_peripheral_reg_top #(
   assign perf_counter_enable_1_icache_stall_1_we = addr_hit[1] & reg_we & !reg_error;
   assign perf_counter_enable_1_icache_stall_1_wd = reg_wdata[30];
 
+  assign perf_counter_enable_1_dimc_1_we = addr_hit[1] & reg_we & !reg_error;
+  assign perf_counter_enable_1_dimc_1_wd = reg_wdata[31];
+
   assign hart_select_0_we = addr_hit[2] & reg_we & !reg_error;
   assign hart_select_0_wd = reg_wdata[9:0];
 
@@ -2410,6 +2538,12 @@ module spatz_cluster_peripheral_reg_top #(
   assign cluster_eoc_exit_we = addr_hit[12] & reg_we & !reg_error;
   assign cluster_eoc_exit_wd = reg_wdata[31:0];
 
+  assign dimc_event_select_0_we = addr_hit[13] & reg_we & !reg_error;
+  assign dimc_event_select_0_wd = reg_wdata[2:0];
+
+  assign dimc_event_select_1_we = addr_hit[14] & reg_we & !reg_error;
+  assign dimc_event_select_1_wd = reg_wdata[2:0];
+
   // Read data return
   always_comb begin
     reg_rdata_next = '0;
@@ -2446,6 +2580,7 @@ module spatz_cluster_peripheral_reg_top #(
         reg_rdata_next[28] = perf_counter_enable_0_icache_prefetch_0_qs;
         reg_rdata_next[29] = perf_counter_enable_0_icache_double_hit_0_qs;
         reg_rdata_next[30] = perf_counter_enable_0_icache_stall_0_qs;
+        reg_rdata_next[31] = perf_counter_enable_0_dimc_0_qs;
       end
 
       addr_hit[1]: begin
@@ -2480,6 +2615,7 @@ module spatz_cluster_peripheral_reg_top #(
         reg_rdata_next[28] = perf_counter_enable_1_icache_prefetch_1_qs;
         reg_rdata_next[29] = perf_counter_enable_1_icache_double_hit_1_qs;
         reg_rdata_next[30] = perf_counter_enable_1_icache_stall_1_qs;
+        reg_rdata_next[31] = perf_counter_enable_1_dimc_1_qs;
       end
 
       addr_hit[2]: begin
@@ -2526,6 +2662,14 @@ module spatz_cluster_peripheral_reg_top #(
         reg_rdata_next[31:0] = cluster_eoc_exit_qs;
       end
 
+      addr_hit[13]: begin
+        reg_rdata_next[2:0] = dimc_event_select_0_qs;
+      end
+
+      addr_hit[14]: begin
+        reg_rdata_next[2:0] = dimc_event_select_1_qs;
+      end
+
       default: begin
         reg_rdata_next = '1;
       end
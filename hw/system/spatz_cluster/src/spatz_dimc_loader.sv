@@ -0,0 +1,171 @@
+// Copyright 2023 ETH Zurich and University of Bologna.
+// Solderpad Hardware License, Version 0.51, see LICENSE for details.
+// SPDX-License-Identifier: SHL-0.51
+
+`include "common_cells/registers.svh"
+
+/// DIMC kernel memory window on the cluster DMA crossbar.
+///
+/// Lets the cluster DMA write kernel sections from TCDM straight into the
+/// DIMC kernel memories, bypassing the vector register file. The window is
+/// write-only; reads return zero. Each core owns 32 KiB of the window:
+///
+///   offset[4:0]   byte in section (32 B sections)
+///   offset[6:5]   section
+///   offset[11:7]  kernel row
+///   offset[14:12] macro
+///   offset[15+:]  core
+///
+/// Transfers must cover whole, 32 B aligned sections. Sections whose byte
+/// strobes are all zero are skipped.
+module spatz_dimc_loader
+  import spatz_pkg::dimc_kwr_t; #(
+  parameter int  unsigned NrCores      = 0,
+  parameter int  unsigned AxiAddrWidth = 0,
+  parameter int  unsigned AxiDataWidth = 0,
+  parameter int  unsigned AxiIdWidth   = 0,
+  parameter type          axi_req_t    = logic,
+  parameter type          axi_resp_t   = logic,
+  /// Derived parameter *Do not override*
+  parameter type          addr_t       = logic [AxiAddrWidth-1:0]
+) (
+  input  logic                    clk_i,
+  input  logic                    rst_ni,
+  input  axi_req_t                axi_req_i,
+  output axi_resp_t               axi_resp_o,
+  input  addr_t                   dimc_start_address_i,
+  // Kernel memory write ports, one per core
+  output dimc_kwr_t               dimc_kwr_o,
+  output logic      [NrCores-1:0] dimc_kwr_valid_o,
+  input  logic      [NrCores-1:0] dimc_kwr_ready_i
+);
+
+  localparam int unsigned SectionWidth = 256;
+  localparam int unsigned SectionBytes = SectionWidth / 8;
+  localparam int unsigned CoreIdWidth  = cf_math_pkg::idx_width(NrCores);
+
+  typedef logic [AxiDataWidth-1:0]   data_t;
+  typedef logic [AxiDataWidth/8-1:0] strb_t;
+
+  // -------------
+  // AXI to memory
+  // -------------
+
+  logic  mem_req, mem_gnt, mem_we, mem_rvalid_q;
+  addr_t mem_addr;
+  data_t mem_wdata;
+  strb_t mem_strb;
+
+  axi_to_mem_interleaved #(
+    .axi_req_t  (axi_req_t   ),
+    .axi_resp_t (axi_resp_t  ),
+    .AddrWidth  (AxiAddrWidth),
+    .DataWidth  (AxiDataWidth),
+    .IdWidth    (AxiIdWidth  ),
+    .NumBanks   (1           ),
+    .BufDepth   (2           )
+  ) i_axi_to_mem (
+    .clk_i        (clk_i                                 ),
+    .rst_ni       (rst_ni                                ),
+    .test_i       ('0                                    ),
+    .busy_o       (/* Unused */                          ),
+    .axi_req_i    (axi_req_i                             ),
+    .axi_resp_o   (axi_resp_o                            ),
+    .mem_req_o    (mem_req                               ),
+    .mem_gnt_i    (mem_gnt                               ),
+    .mem_addr_o   (mem_addr                              ),
+    .mem_wdata_o  (mem_wdata                             ),
+    .mem_strb_o   (mem_strb                              ),
+    .mem_atop_o   (/* The DMA does not support atomics */),
+    .mem_we_o     (mem_we                                ),
+    .mem_rvalid_i (mem_rvalid_q                          ),
+    .mem_rdata_i  ('0                                    )
+  );
+
+  // Every granted request is answered in the next cycle. For writes, this is
+  // after the section was accepted by the kernel memory, so the DMA transfer
+  // completes only once the weights are in place.
+  `FF(mem_rvalid_q, mem_req && mem_gnt, 1'b0)
+
+  // ----------------
+  // Section assembly
+  // ----------------
+
+  addr_t                    offset;
+  logic  [SectionWidth-1:0] sec_data;
+  logic                     sec_valid, sec_ready;
+
+  assign offset = mem_addr - dimc_start_address_i;
+
+  if (AxiDataWidth >= SectionWidth) begin: gen_split
+    // A beat carries one or more sections, written one per cycle
+    localparam int unsigned NrSecPerBeat = AxiDataWidth / SectionWidth;
+    localparam int unsigned SecIdxWidth  = cf_math_pkg::idx_width(NrSecPerBeat);
+
+    logic [SecIdxWidth-1:0] sec_idx_d, sec_idx_q;
+    logic                   sec_last, sec_active;
+    addr_t                  sec_offset;
+
+    assign sec_last   = (sec_idx_q == SecIdxWidth'(NrSecPerBeat - 1));
+    assign sec_active = |mem_strb[sec_idx_q*SectionBytes +: SectionBytes];
+    assign sec_data   = mem_wdata[sec_idx_q*SectionWidth +: SectionWidth];
+    assign sec_valid  = mem_req && mem_we && sec_active;
+    assign sec_offset = (offset & ~addr_t'(AxiDataWidth/8 - 1)) + sec_idx_q * SectionBytes;
+    assign mem_gnt    = mem_req && (!mem_we || (sec_last && (!sec_active || sec_ready)));
+
+    always_comb begin
+      sec_idx_d = sec_idx_q;
+      if (mem_req && mem_we && (!sec_active || sec_ready))
+        sec_idx_d = sec_last ? '0 : sec_idx_q + 1;
+    end
+    `FF(sec_idx_q, sec_idx_d, '0)
+
+    assign dimc_kwr_o.macro = sec_offset[14:12];
+    assign dimc_kwr_o.addr  = sec_offset[11:5];
+    assign dimc_kwr_o.data  = sec_data;
+
+    for (genvar c = 0; c < NrCores; c++) begin: gen_core_valid
+      assign dimc_kwr_valid_o[c] = sec_valid &&
+                                   (NrCores == 1 || sec_offset[15 +: CoreIdWidth] == CoreIdWidth'(c));
+    end
+  end: gen_split else begin: gen_gather
+    // A section spans several beats, collected before it is written
+    localparam int unsigned NrBeatsPerSec = SectionWidth / AxiDataWidth;
+    localparam int unsigned BeatIdxWidth  = cf_math_pkg::idx_width(NrBeatsPerSec);
+
+    logic [NrBeatsPerSec-1:0][AxiDataWidth-1:0] buffer_q;
+    logic [BeatIdxWidth-1:0]                     beat_idx;
+    logic                                        beat_last;
+
+    assign beat_idx  = offset[$clog2(AxiDataWidth/8) +: BeatIdxWidth];
+    assign beat_last = (beat_idx == BeatIdxWidth'(NrBeatsPerSec - 1));
+
+    always_comb begin
+      sec_data = buffer_q;
+      sec_data[beat_idx*AxiDataWidth +: AxiDataWidth] = mem_wdata;
+    end
+
+    assign sec_valid = mem_req && mem_we && beat_last;
+    assign mem_gnt   = mem_req && (!mem_we || !beat_last || sec_ready);
+
+    always_ff @(posedge clk_i or negedge rst_ni) begin
+      if (!rst_ni)
+        buffer_q <= '0;
+      else if (mem_req && mem_we && !beat_last)
+        buffer_q[beat_idx] <= mem_wdata;
+    end
+
+    assign dimc_kwr_o.macro = offset[14:12];
+    assign dimc_kwr_o.addr  = offset[11:5];
+    assign dimc_kwr_o.data  = sec_data;
+
+    for (genvar c = 0; c < NrCores; c++) begin: gen_core_valid
+      assign dimc_kwr_valid_o[c] = sec_valid &&
+                                   (NrCores == 1 || offset[15 +: CoreIdWidth] == CoreIdWidth'(c));
+    end
+  end: gen_gather
+
+  // Writes to a core outside the cluster are dropped
+  assign sec_ready = |(dimc_kwr_valid_o & dimc_kwr_ready_i) || (sec_valid && !(|dimc_kwr_valid_o));
+
+endmodule
@@ -0,0 +1,548 @@
+// Copyright 2023 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+// This file was generated automatically.
+
+#pragma once
+#include <stdint.h>
+
+// 32 output channels x 160 elements at 8 bits
+#define DENSE_N 32
+#define DENSE_K 160
+#define DENSE_MODE 15
+#define DENSE_N_DIMC 1
+#define DENSE_N_TILES 1
+#define DENSE_K_TILES 2
+#define DENSE_TILE_BYTES 4096
+
+// Kernel memory image of every tile, N tile major
+static const uint8_t dense_kernel[2][4096] __attribute__((aligned(32), section(".data"))) = {
+    {
+        0x81, 0x8c, 0x97, 0xa2, 0xad, 0xb8, 0xc3, 0xce, 0xd9, 0xe4, 0xef, 0xfa, 0x05, 0x10, 0x1b, 0x26,
+        0x31, 0x3c, 0x47, 0x52, 0x5d, 0x68, 0x73, 0x7e, 0x8a, 0x95, 0xa0, 0xab, 0xb6, 0xc1, 0xcc, 0xd7,
+        0xe2, 0xed, 0xf8, 0x03, 0x0e, 0x19, 0x24, 0x2f, 0x3a, 0x45, 0x50, 0x5b, 0x66, 0x71, 0x7c, 0x88,
+        0x93, 0x9e, 0xa9, 0xb4, 0xbf, 0xca, 0xd5, 0xe0, 0xeb, 0xf6, 0x01, 0x0c, 0x17, 0x22, 0x2d, 0x38,
+        0x43, 0x4e, 0x59, 0x64, 0x6f, 0x7a, 0x86, 0x91, 0x9c, 0xa7, 0xb2, 0xbd, 0xc8, 0xd3, 0xde, 0xe9,
+        0xf4, 0xff, 0x0a, 0x15, 0x20, 0x2b, 0x36, 0x41, 0x4c, 0x57, 0x62, 0x6d, 0x78, 0x84, 0x8f, 0x9a,
+        0xa5, 0xb0, 0xbb, 0xc6, 0xd1, 0xdc, 0xe7, 0xf2, 0xfd, 0x08, 0x13, 0x1e, 0x29, 0x34, 0x3f, 0x4a,
+        0x55, 0x60, 0x6b, 0x76, 0x82, 0x8d, 0x98, 0xa3, 0xae, 0xb9, 0xc4, 0xcf, 0xda, 0xe5, 0xf0, 0xfb,
+        0xa6, 0xb1, 0xbc, 0xc7, 0xd2, 0xdd, 0xe8, 0xf3, 0xfe, 0x09, 0x14, 0x1f, 0x2a, 0x35, 0x40, 0x4b,
+        0x56, 0x61, 0x6c, 0x77, 0x83, 0x8e, 0x99, 0xa4, 0xaf, 0xba, 0xc5, 0xd0, 0xdb, 0xe6, 0xf1, 0xfc,
+        0x07, 0x12, 0x1d, 0x28, 0x33, 0x3e, 0x49, 0x54, 0x5f, 0x6a, 0x75, 0x81, 0x8c, 0x97, 0xa2, 0xad,
+        0xb8, 0xc3, 0xce, 0xd9, 0xe4, 0xef, 0xfa, 0x05, 0x10, 0x1b, 0x26, 0x31, 0x3c, 0x47, 0x52, 0x5d,
+        0x68, 0x73, 0x7e, 0x8a, 0x95, 0xa0, 0xab, 0xb6, 0xc1, 0xcc, 0xd7, 0xe2, 0xed, 0xf8, 0x03, 0x0e,
+        0x19, 0x24, 0x2f, 0x3a, 0x45, 0x50, 0x5b, 0x66, 0x71, 0x7c, 0x88, 0x93, 0x9e, 0xa9, 0xb4, 0xbf,
+        0xca, 0xd5, 0xe0, 0xeb, 0xf6, 0x01, 0x0c, 0x17, 0x22, 0x2d, 0x38, 0x43, 0x4e, 0x59, 0x64, 0x6f,
+        0x7a, 0x86, 0x91, 0x9c, 0xa7, 0xb2, 0xbd, 0xc8, 0xd3, 0xde, 0xe9, 0xf4, 0xff, 0x0a, 0x15, 0x20,
+        0xcb, 0xd6, 0xe1, 0xec, 0xf7, 0x02, 0x0d, 0x18, 0x23, 0x2e, 0x39, 0x44, 0x4f, 0x5a, 0x65, 0x70,
+        0x7b, 0x87, 0x92, 0x9d, 0xa8, 0xb3, 0xbe, 0xc9, 0xd4, 0xdf, 0xea, 0xf5, 0x00, 0x0b, 0x16, 0x21,
+        0x2c, 0x37, 0x42, 0x4d, 0x58, 0x63, 0x6e, 0x79, 0x85, 0x90, 0x9b, 0xa6, 0xb1, 0xbc, 0xc7, 0xd2,
+        0xdd, 0xe8, 0xf3, 0xfe, 0x09, 0x14, 0x1f, 0x2a, 0x35, 0x40, 0x4b, 0x56, 0x61, 0x6c, 0x77, 0x83,
+        0x8e, 0x99, 0xa4, 0xaf, 0xba, 0xc5, 0xd0, 0xdb, 0xe6, 0xf1, 0xfc, 0x07, 0x12, 0x1d, 0x28, 0x33,
+        0x3e, 0x49, 0x54, 0x5f, 0x6a, 0x75, 0x81, 0x8c, 0x97, 0xa2, 0xad, 0xb8, 0xc3, 0xce, 0xd9, 0xe4,
+        0xef, 0xfa, 0x05, 0x10, 0x1b, 0x26, 0x31, 0x3c, 0x47, 0x52, 0x5d, 0x68, 0x73, 0x7e, 0x8a, 0x95,
+        0xa0, 0xab, 0xb6, 0xc1, 0xcc, 0xd7, 0xe2, 0xed, 0xf8, 0x03, 0x0e, 0x19, 0x24, 0x2f, 0x3a, 0x45,
+        0xf0, 0xfb, 0x06, 0x11, 0x1c, 0x27, 0x32, 0x3d, 0x48, 0x53, 0x5e, 0x69, 0x74, 0x7f, 0x8b, 0x96,
+        0xa1, 0xac, 0xb7, 0xc2, 0xcd, 0xd8, 0xe3, 0xee, 0xf9, 0x04, 0x0f, 0x1a, 0x25, 0x30, 0x3b, 0x46,
+        0x51, 0x5c, 0x67, 0x72, 0x7d, 0x89, 0x94, 0x9f, 0xaa, 0xb5, 0xc0, 0xcb, 0xd6, 0xe1, 0xec, 0xf7,
+        0x02, 0x0d, 0x18, 0x23, 0x2e, 0x39, 0x44, 0x4f, 0x5a, 0x65, 0x70, 0x7b, 0x87, 0x92, 0x9d, 0xa8,
+        0xb3, 0xbe, 0xc9, 0xd4, 0xdf, 0xea, 0xf5, 0x00, 0x0b, 0x16, 0x21, 0x2c, 0x37, 0x42, 0x4d, 0x58,
+        0x63, 0x6e, 0x79, 0x85, 0x90, 0x9b, 0xa6, 0xb1, 0xbc, 0xc7, 0xd2, 0xdd, 0xe8, 0xf3, 0xfe, 0x09,
+        0x14, 0x1f, 0x2a, 0x35, 0x40, 0x4b, 0x56, 0x61, 0x6c, 0x77, 0x83, 0x8e, 0x99, 0xa4, 0xaf, 0xba,
+        0xc5, 0xd0, 0xdb, 0xe6, 0xf1, 0xfc, 0x07, 0x12, 0x1d, 0x28, 0x33, 0x3e, 0x49, 0x54, 0x5f, 0x6a,
+        0x15, 0x20, 0x2b, 0x36, 0x41, 0x4c, 0x57, 0x62, 0x6d, 0x78, 0x84, 0x8f, 0x9a, 0xa5, 0xb0, 0xbb,
+        0xc6, 0xd1, 0xdc, 0xe7, 0xf2, 0xfd, 0x08, 0x13, 0x1e, 0x29, 0x34, 0x3f, 0x4a, 0x55, 0x60, 0x6b,
+        0x76, 0x82, 0x8d, 0x98, 0xa3, 0xae, 0xb9, 0xc4, 0xcf, 0xda, 0xe5, 0xf0, 0xfb, 0x06, 0x11, 0x1c,
+        0x27, 0x32, 0x3d, 0x48, 0x53, 0x5e, 0x69, 0x74, 0x7f, 0x8b, 0x96, 0xa1, 0xac, 0xb7, 0xc2, 0xcd,
+        0xd8, 0xe3, 0xee, 0xf9, 0x04, 0x0f, 0x1a, 0x25, 0x30, 0x3b, 0x46, 0x51, 0x5c, 0x67, 0x72, 0x7d,
+        0x89, 0x94, 0x9f, 0xaa, 0xb5, 0xc0, 0xcb, 0xd6, 0xe1, 0xec, 0xf7, 0x02, 0x0d, 0x18, 0x23, 0x2e,
+        0x39, 0x44, 0x4f, 0x5a, 0x65, 0x70, 0x7b, 0x87, 0x92, 0x9d, 0xa8, 0xb3, 0xbe, 0xc9, 0xd4, 0xdf,
+        0xea, 0xf5, 0x00, 0x0b, 0x16, 0x21, 0x2c, 0x37, 0x42, 0x4d, 0x58, 0x63, 0x6e, 0x79, 0x85, 0x90,
+        0x3a, 0x45, 0x50, 0x5b, 0x66, 0x71, 0x7c, 0x88, 0x93, 0x9e, 0xa9, 0xb4, 0xbf, 0xca, 0xd5, 0xe0,
+        0xeb, 0xf6, 0x01, 0x0c, 0x17, 0x22, 0x2d, 0x38, 0x43, 0x4e, 0x59, 0x64, 0x6f, 0x7a, 0x86, 0x91,
+        0x9c, 0xa7, 0xb2, 0xbd, 0xc8, 0xd3, 0xde, 0xe9, 0xf4, 0xff, 0x0a, 0x15, 0x20, 0x2b, 0x36, 0x41,
+        0x4c, 0x57, 0x62, 0x6d, 0x78, 0x84, 0x8f, 0x9a, 0xa5, 0xb0, 0xbb, 0xc6, 0xd1, 0xdc, 0xe7, 0xf2,
+        0xfd, 0x08, 0x13, 0x1e, 0x29, 0x34, 0x3f, 0x4a, 0x55, 0x60, 0x6b, 0x76, 0x82, 0x8d, 0x98, 0xa3,
+        0xae, 0xb9, 0xc4, 0xcf, 0xda, 0xe5, 0xf0, 0xfb, 0x06, 0x11, 0x1c, 0x27, 0x32, 0x3d, 0x48, 0x53,
+        0x5e, 0x69, 0x74, 0x7f, 0x8b, 0x96, 0xa1, 0xac, 0xb7, 0xc2, 0xcd, 0xd8, 0xe3, 0xee, 0xf9, 0x04,
+        0x0f, 0x1a, 0x25, 0x30, 0x3b, 0x46, 0x51, 0x5c, 0x67, 0x72, 0x7d, 0x89, 0x94, 0x9f, 0xaa, 0xb5,
+        0x5f, 0x6a, 0x75, 0x81, 0x8c, 0x97, 0xa2, 0xad, 0xb8, 0xc3, 0xce, 0xd9, 0xe4, 0xef, 0xfa, 0x05,
+        0x10, 0x1b, 0x26, 0x31, 0x3c, 0x47, 0x52, 0x5d, 0x68, 0x73, 0x7e, 0x8a, 0x95, 0xa0, 0xab, 0xb6,
+        0xc1, 0xcc, 0xd7, 0xe2, 0xed, 0xf8, 0x03, 0x0e, 0x19, 0x24, 0x2f, 0x3a, 0x45, 0x50, 0x5b, 0x66,
+        0x71, 0x7c, 0x88, 0x93, 0x9e, 0xa9, 0xb4, 0xbf, 0xca, 0xd5, 0xe0, 0xeb, 0xf6, 0x01, 0x0c, 0x17,
+        0x22, 0x2d, 0x38, 0x43, 0x4e, 0x59, 0x64, 0x6f, 0x7a, 0x86, 0x91, 0x9c, 0xa7, 0xb2, 0xbd, 0xc8,
+        0xd3, 0xde, 0xe9, 0xf4, 0xff, 0x0a, 0x15, 0x20, 0x2b, 0x36, 0x41, 0x4c, 0x57, 0x62, 0x6d, 0x78,
+        0x84, 0x8f, 0x9a, 0xa5, 0xb0, 0xbb, 0xc6, 0xd1, 0xdc, 0xe7, 0xf2, 0xfd, 0x08, 0x13, 0x1e, 0x29,
+        0x34, 0x3f, 0x4a, 0x55, 0x60, 0x6b, 0x76, 0x82, 0x8d, 0x98, 0xa3, 0xae, 0xb9, 0xc4, 0xcf, 0xda,
+        0x85, 0x90, 0x9b, 0xa6, 0xb1, 0xbc, 0xc7, 0xd2, 0xdd, 0xe8, 0xf3, 0xfe, 0x09, 0x14, 0x1f, 0x2a,
+        0x35, 0x40, 0x4b, 0x56, 0x61, 0x6c, 0x77, 0x83, 0x8e, 0x99, 0xa4, 0xaf, 0xba, 0xc5, 0xd0, 0xdb,
+        0xe6, 0xf1, 0xfc, 0x07, 0x12, 0x1d, 0x28, 0x33, 0x3e, 0x49, 0x54, 0x5f, 0x6a, 0x75, 0x81, 0x8c,
+        0x97, 0xa2, 0xad, 0xb8, 0xc3, 0xce, 0xd9, 0xe4, 0xef, 0xfa, 0x05, 0x10, 0x1b, 0x26, 0x31, 0x3c,
+        0x47, 0x52, 0x5d, 0x68, 0x73, 0x7e, 0x8a, 0x95, 0xa0, 0xab, 0xb6, 0xc1, 0xcc, 0xd7, 0xe2, 0xed,
+        0xf8, 0x03, 0x0e, 0x19, 0x24, 0x2f, 0x3a, 0x45, 0x50, 0x5b, 0x66, 0x71, 0x7c, 0x88, 0x93, 0x9e,
+        0xa9, 0xb4, 0xbf, 0xca, 0xd5, 0xe0, 0xeb, 0xf6, 0x01, 0x0c, 0x17, 0x22, 0x2d, 0x38, 0x43, 0x4e,
+        0x59, 0x64, 0x6f, 0x7a, 0x86, 0x91, 0x9c, 0xa7, 0xb2, 0xbd, 0xc8, 0xd3, 0xde, 0xe9, 0xf4, 0xff,
+        0xaa, 0xb5, 0xc0, 0xcb, 0xd6, 0xe1, 0xec, 0xf7, 0x02, 0x0d, 0x18, 0x23, 0x2e, 0x39, 0x44, 0x4f,
+        0x5a, 0x65, 0x70, 0x7b, 0x87, 0x92, 0x9d, 0xa8, 0xb3, 0xbe, 0xc9, 0xd4, 0xdf, 0xea, 0xf5, 0x00,
+        0x0b, 0x16, 0x21, 0x2c, 0x37, 0x42, 0x4d, 0x58, 0x63, 0x6e, 0x79, 0x85, 0x90, 0x9b, 0xa6, 0xb1,
+        0xbc, 0xc7, 0xd2, 0xdd, 0xe8, 0xf3, 0xfe, 0x09, 0x14, 0x1f, 0x2a, 0x35, 0x40, 0x4b, 0x56, 0x61,
+        0x6c, 0x77, 0x83, 0x8e, 0x99, 0xa4, 0xaf, 0xba, 0xc5, 0xd0, 0xdb, 0xe6, 0xf1, 0xfc, 0x07, 0x12,
+        0x1d, 0x28, 0x33, 0x3e, 0x49, 0x54, 0x5f, 0x6a, 0x75, 0x81, 0x8c, 0x97, 0xa2, 0xad, 0xb8, 0xc3,
+        0xce, 0xd9, 0xe4, 0xef, 0xfa, 0x05, 0x10, 0x1b, 0x26, 0x31, 0x3c, 0x47, 0x52, 0x5d, 0x68, 0x73,
+        0x7e, 0x8a, 0x95, 0xa0, 0xab, 0xb6, 0xc1, 0xcc, 0xd7, 0xe2, 0xed, 0xf8, 0x03, 0x0e, 0x19, 0x24,
+        0xcf, 0xda, 0xe5, 0xf0, 0xfb, 0x06, 0x11, 0x1c, 0x27, 0x32, 0x3d, 0x48, 0x53, 0x5e, 0x69, 0x74,
+        0x7f, 0x8b, 0x96, 0xa1, 0xac, 0xb7, 0xc2, 0xcd, 0xd8, 0xe3, 0xee, 0xf9, 0x04, 0x0f, 0x1a, 0x25,
+        0x30, 0x3b, 0x46, 0x51, 0x5c, 0x67, 0x72, 0x7d, 0x89, 0x94, 0x9f, 0xaa, 0xb5, 0xc0, 0xcb, 0xd6,
+        0xe1, 0xec, 0xf7, 0x02, 0x0d, 0x18, 0x23, 0x2e, 0x39, 0x44, 0x4f, 0x5a, 0x65, 0x70, 0x7b, 0x87,
+        0x92, 0x9d, 0xa8, 0xb3, 0xbe, 0xc9, 0xd4, 0xdf, 0xea, 0xf5, 0x00, 0x0b, 0x16, 0x21, 0x2c, 0x37,
+        0x42, 0x4d, 0x58, 0x63, 0x6e, 0x79, 0x85, 0x90, 0x9b, 0xa6, 0xb1, 0xbc, 0xc7, 0xd2, 0xdd, 0xe8,
+        0xf3, 0xfe, 0x09, 0x14, 0x1f, 0x2a, 0x35, 0x40, 0x4b, 0x56, 0x61, 0x6c, 0x77, 0x83, 0x8e, 0x99,
+        0xa4, 0xaf, 0xba, 0xc5, 0xd0, 0xdb, 0xe6, 0xf1, 0xfc, 0x07, 0x12, 0x1d, 0x28, 0x33, 0x3e, 0x49,
+        0xf4, 0xff, 0x0a, 0x15, 0x20, 0x2b, 0x36, 0x41, 0x4c, 0x57, 0x62, 0x6d, 0x78, 0x84, 0x8f, 0x9a,
+        0xa5, 0xb0, 0xbb, 0xc6, 0xd1, 0xdc, 0xe7, 0xf2, 0xfd, 0x08, 0x13, 0x1e, 0x29, 0x34, 0x3f, 0x4a,
+        0x55, 0x60, 0x6b, 0x76, 0x82, 0x8d, 0x98, 0xa3, 0xae, 0xb9, 0xc4, 0xcf, 0xda, 0xe5, 0xf0, 0xfb,
+        0x06, 0x11, 0x1c, 0x27, 0x32, 0x3d, 0x48, 0x53, 0x5e, 0x69, 0x74, 0x7f, 0x8b, 0x96, 0xa1, 0xac,
+        0xb7, 0xc2, 0xcd, 0xd8, 0xe3, 0xee, 0xf9, 0x04, 0x0f, 0x1a, 0x25, 0x30, 0x3b, 0x46, 0x51, 0x5c,
+        0x67, 0x72, 0x7d, 0x89, 0x94, 0x9f, 0xaa, 0xb5, 0xc0, 0xcb, 0xd6, 0xe1, 0xec, 0xf7, 0x02, 0x0d,
+        0x18, 0x23, 0x2e, 0x39, 0x44, 0x4f, 0x5a, 0x65, 0x70, 0x7b, 0x87, 0x92, 0x9d, 0xa8, 0xb3, 0xbe,
+        0xc9, 0xd4, 0xdf, 0xea, 0xf5, 0x00, 0x0b, 0x16, 0x21, 0x2c, 0x37, 0x42, 0x4d, 0x58, 0x63, 0x6e,
+        0x19, 0x24, 0x2f, 0x3a, 0x45, 0x50, 0x5b, 0x66, 0x71, 0x7c, 0x88, 0x93, 0x9e, 0xa9, 0xb4, 0xbf,
+        0xca, 0xd5, 0xe0, 0xeb, 0xf6, 0x01, 0x0c, 0x17, 0x22, 0x2d, 0x38, 0x43, 0x4e, 0x59, 0x64, 0x6f,
+        0x7a, 0x86, 0x91, 0x9c, 0xa7, 0xb2, 0xbd, 0xc8, 0xd3, 0xde, 0xe9, 0xf4, 0xff, 0x0a, 0x15, 0x20,
+        0x2b, 0x36, 0x41, 0x4c, 0x57, 0x62, 0x6d, 0x78, 0x84, 0x8f, 0x9a, 0xa5, 0xb0, 0xbb, 0xc6, 0xd1,
+        0xdc, 0xe7, 0xf2, 0xfd, 0x08, 0x13, 0x1e, 0x29, 0x34, 0x3f, 0x4a, 0x55, 0x60, 0x6b, 0x76, 0x82,
+        0x8d, 0x98, 0xa3, 0xae, 0xb9, 0xc4, 0xcf, 0xda, 0xe5, 0xf0, 0xfb, 0x06, 0x11, 0x1c, 0x27, 0x32,
+        0x3d, 0x48, 0x53, 0x5e, 0x69, 0x74, 0x7f, 0x8b, 0x96, 0xa1, 0xac, 0xb7, 0xc2, 0xcd, 0xd8, 0xe3,
+        0xee, 0xf9, 0x04, 0x0f, 0x1a, 0x25, 0x30, 0x3b, 0x46, 0x51, 0x5c, 0x67, 0x72, 0x7d, 0x89, 0x94,
+        0x3e, 0x49, 0x54, 0x5f, 0x6a, 0x75, 0x81, 0x8c, 0x97, 0xa2, 0xad, 0xb8, 0xc3, 0xce, 0xd9, 0xe4,
+        0xef, 0xfa, 0x05, 0x10, 0x1b, 0x26, 0x31, 0x3c, 0x47, 0x52, 0x5d, 0x68, 0x73, 0x7e, 0x8a, 0x95,
+        0xa0, 0xab, 0xb6, 0xc1, 0xcc, 0xd7, 0xe2, 0xed, 0xf8, 0x03, 0x0e, 0x19, 0x24, 0x2f, 0x3a, 0x45,
+        0x50, 0x5b, 0x66, 0x71, 0x7c, 0x88, 0x93, 0x9e, 0xa9, 0xb4, 0xbf, 0xca, 0xd5, 0xe0, 0xeb, 0xf6,
+        0x01, 0x0c, 0x17, 0x22, 0x2d, 0x38, 0x43, 0x4e, 0x59, 0x64, 0x6f, 0x7a, 0x86, 0x91, 0x9c, 0xa7,
+        0xb2, 0xbd, 0xc8, 0xd3, 0xde, 0xe9, 0xf4, 0xff, 0x0a, 0x15, 0x20, 0x2b, 0x36, 0x41, 0x4c, 0x57,
+        0x62, 0x6d, 0x78, 0x84, 0x8f, 0x9a, 0xa5, 0xb0, 0xbb, 0xc6, 0xd1, 0xdc, 0xe7, 0xf2, 0xfd, 0x08,
+        0x13, 0x1e, 0x29, 0x34, 0x3f, 0x4a, 0x55, 0x60, 0x6b, 0x76, 0x82, 0x8d, 0x98, 0xa3, 0xae, 0xb9,
+        0x63, 0x6e, 0x79, 0x85, 0x90, 0x9b, 0xa6, 0xb1, 0xbc, 0xc7, 0xd2, 0xdd, 0xe8, 0xf3, 0xfe, 0x09,
+        0x14, 0x1f, 0x2a, 0x35, 0x40, 0x4b, 0x56, 0x61, 0x6c, 0x77, 0x83, 0x8e, 0x99, 0xa4, 0xaf, 0xba,
+        0xc5, 0xd0, 0xdb, 0xe6, 0xf1, 0xfc, 0x07, 0x12, 0x1d, 0x28, 0x33, 0x3e, 0x49, 0x54, 0x5f, 0x6a,
+        0x75, 0x81, 0x8c, 0x97, 0xa2, 0xad, 0xb8, 0xc3, 0xce, 0xd9, 0xe4, 0xef, 0xfa, 0x05, 0x10, 0x1b,
+        0x26, 0x31, 0x3c, 0x47, 0x52, 0x5d, 0x68, 0x73, 0x7e, 0x8a, 0x95, 0xa0, 0xab, 0xb6, 0xc1, 0xcc,
+        0xd7, 0xe2, 0xed, 0xf8, 0x03, 0x0e, 0x19, 0x24, 0x2f, 0x3a, 0x45, 0x50, 0x5b, 0x66, 0x71, 0x7c,
+        0x88, 0x93, 0x9e, 0xa9, 0xb4, 0xbf, 0xca, 0xd5, 0xe0, 0xeb, 0xf6, 0x01, 0x0c, 0x17, 0x22, 0x2d,
+        0x38, 0x43, 0x4e, 0x59, 0x64, 0x6f, 0x7a, 0x86, 0x91, 0x9c, 0xa7, 0xb2, 0xbd, 0xc8, 0xd3, 0xde,
+        0x89, 0x94, 0x9f, 0xaa, 0xb5, 0xc0, 0xcb, 0xd6, 0xe1, 0xec, 0xf7, 0x02, 0x0d, 0x18, 0x23, 0x2e,
+        0x39, 0x44, 0x4f, 0x5a, 0x65, 0x70, 0x7b, 0x87, 0x92, 0x9d, 0xa8, 0xb3, 0xbe, 0xc9, 0xd4, 0xdf,
+        0xea, 0xf5, 0x00, 0x0b, 0x16, 0x21, 0x2c, 0x37, 0x42, 0x4d, 0x58, 0x63, 0x6e, 0x79, 0x85, 0x90,
+        0x9b, 0xa6, 0xb1, 0xbc, 0xc7, 0xd2, 0xdd, 0xe8, 0xf3, 0xfe, 0x09, 0x14, 0x1f, 0x2a, 0x35, 0x40,
+        0x4b, 0x56, 0x61, 0x6c, 0x77, 0x83, 0x8e, 0x99, 0xa4, 0xaf, 0xba, 0xc5, 0xd0, 0xdb, 0xe6, 0xf1,
+        0xfc, 0x07, 0x12, 0x1d, 0x28, 0x33, 0x3e, 0x49, 0x54, 0x5f, 0x6a, 0x75, 0x81, 0x8c, 0x97, 0xa2,
+        0xad, 0xb8, 0xc3, 0xce, 0xd9, 0xe4, 0xef, 0xfa, 0x05, 0x10, 0x1b, 0x26, 0x31, 0x3c, 0x47, 0x52,
+        0x5d, 0x68, 0x73, 0x7e, 0x8a, 0x95, 0xa0, 0xab, 0xb6, 0xc1, 0xcc, 0xd7, 0xe2, 0xed, 0xf8, 0x03,
+        0xae, 0xb9, 0xc4, 0xcf, 0xda, 0xe5, 0xf0, 0xfb, 0x06, 0x11, 0x1c, 0x27, 0x32, 0x3d, 0x48, 0x53,
+        0x5e, 0x69, 0x74, 0x7f, 0x8b, 0x96, 0xa1, 0xac, 0xb7, 0xc2, 0xcd, 0xd8, 0xe3, 0xee, 0xf9, 0x04,
+        0x0f, 0x1a, 0x25, 0x30, 0x3b, 0x46, 0x51, 0x5c, 0x67, 0x72, 0x7d, 0x89, 0x94, 0x9f, 0xaa, 0xb5,
+        0xc0, 0xcb, 0xd6, 0xe1, 0xec, 0xf7, 0x02, 0x0d, 0x18, 0x23, 0x2e, 0x39, 0x44, 0x4f, 0x5a, 0x65,
+        0x70, 0x7b, 0x87, 0x92, 0x9d, 0xa8, 0xb3, 0xbe, 0xc9, 0xd4, 0xdf, 0xea, 0xf5, 0x00, 0x0b, 0x16,
+        0x21, 0x2c, 0x37, 0x42, 0x4d, 0x58, 0x63, 0x6e, 0x79, 0x85, 0x90, 0x9b, 0xa6, 0xb1, 0xbc, 0xc7,
+        0xd2, 0xdd, 0xe8, 0xf3, 0xfe, 0x09, 0x14, 0x1f, 0x2a, 0x35, 0x40, 0x4b, 0x56, 0x61, 0x6c, 0x77,
+        0x83, 0x8e, 0x99, 0xa4, 0xaf, 0xba, 0xc5, 0xd0, 0xdb, 0xe6, 0xf1, 0xfc, 0x07, 0x12, 0x1d, 0x28,
+        0xd3, 0xde, 0xe9, 0xf4, 0xff, 0x0a, 0x15, 0x20, 0x2b, 0x36, 0x41, 0x4c, 0x57, 0x62, 0x6d, 0x78,
+        0x84, 0x8f, 0x9a, 0xa5, 0xb0, 0xbb, 0xc6, 0xd1, 0xdc, 0xe7, 0xf2, 0xfd, 0x08, 0x13, 0x1e, 0x29,
+        0x34, 0x3f, 0x4a, 0x55, 0x60, 0x6b, 0x76, 0x82, 0x8d, 0x98, 0xa3, 0xae, 0xb9, 0xc4, 0xcf, 0xda,
+        0xe5, 0xf0, 0xfb, 0x06, 0x11, 0x1c, 0x27, 0x32, 0x3d, 0x48, 0x53, 0x5e, 0x69, 0x74, 0x7f, 0x8b,
+        0x96, 0xa1, 0xac, 0xb7, 0xc2, 0xcd, 0xd8, 0xe3, 0xee, 0xf9, 0x04, 0x0f, 0x1a, 0x25, 0x30, 0x3b,
+        0x46, 0x51, 0x5c, 0x67, 0x72, 0x7d, 0x89, 0x94, 0x9f, 0xaa, 0xb5, 0xc0, 0xcb, 0xd6, 0xe1, 0xec,
+        0xf7, 0x02, 0x0d, 0x18, 0x23, 0x2e, 0x39, 0x44, 0x4f, 0x5a, 0x65, 0x70, 0x7b, 0x87, 0x92, 0x9d,
+        0xa8, 0xb3, 0xbe, 0xc9, 0xd4, 0xdf, 0xea, 0xf5, 0x00, 0x0b, 0x16, 0x21, 0x2c, 0x37, 0x42, 0x4d,
+        0xf8, 0x03, 0x0e, 0x19, 0x24, 0x2f, 0x3a, 0x45, 0x50, 0x5b, 0x66, 0x71, 0x7c, 0x88, 0x93, 0x9e,
+        0xa9, 0xb4, 0xbf, 0xca, 0xd5, 0xe0, 0xeb, 0xf6, 0x01, 0x0c, 0x17, 0x22, 0x2d, 0x38, 0x43, 0x4e,
+        0x59, 0x64, 0x6f, 0x7a, 0x86, 0x91, 0x9c, 0xa7, 0xb2, 0xbd, 0xc8, 0xd3, 0xde, 0xe9, 0xf4, 0xff,
+        0x0a, 0x15, 0x20, 0x2b, 0x36, 0x41, 0x4c, 0x57, 0x62, 0x6d, 0x78, 0x84, 0x8f, 0x9a, 0xa5, 0xb0,
+        0xbb, 0xc6, 0xd1, 0xdc, 0xe7, 0xf2, 0xfd, 0x08, 0x13, 0x1e, 0x29, 0x34, 0x3f, 0x4a, 0x55, 0x60,
+        0x6b, 0x76, 0x82, 0x8d, 0x98, 0xa3, 0xae, 0xb9, 0xc4, 0xcf, 0xda, 0xe5, 0xf0, 0xfb, 0x06, 0x11,
+        0x1c, 0x27, 0x32, 0x3d, 0x48, 0x53, 0x5e, 0x69, 0x74, 0x7f, 0x8b, 0x96, 0xa1, 0xac, 0xb7, 0xc2,
+        0xcd, 0xd8, 0xe3, 0xee, 0xf9, 0x04, 0x0f, 0x1a, 0x25, 0x30, 0x3b, 0x46, 0x51, 0x5c, 0x67, 0x72,
+        0x1d, 0x28, 0x33, 0x3e, 0x49, 0x54, 0x5f, 0x6a, 0x75, 0x81, 0x8c, 0x97, 0xa2, 0xad, 0xb8, 0xc3,
+        0xce, 0xd9, 0xe4, 0xef, 0xfa, 0x05, 0x10, 0x1b, 0x26, 0x31, 0x3c, 0x47, 0x52, 0x5d, 0x68, 0x73,
+        0x7e, 0x8a, 0x95, 0xa0, 0xab, 0xb6, 0xc1, 0xcc, 0xd7, 0xe2, 0xed, 0xf8, 0x03, 0x0e, 0x19, 0x24,
+        0x2f, 0x3a, 0x45, 0x50, 0x5b, 0x66, 0x71, 0x7c, 0x88, 0x93, 0x9e, 0xa9, 0xb4, 0xbf, 0xca, 0xd5,
+        0xe0, 0xeb, 0xf6, 0x01, 0x0c, 0x17, 0x22, 0x2d, 0x38, 0x43, 0x4e, 0x59, 0x64, 0x6f, 0x7a, 0x86,
+        0x91, 0x9c, 0xa7, 0xb2, 0xbd, 0xc8, 0xd3, 0xde, 0xe9, 0xf4, 0xff, 0x0a, 0x15, 0x20, 0x2b, 0x36,
+        0x41, 0x4c, 0x57, 0x62, 0x6d, 0x78, 0x84, 0x8f, 0x9a, 0xa5, 0xb0, 0xbb, 0xc6, 0xd1, 0xdc, 0xe7,
+        0xf2, 0xfd, 0x08, 0x13, 0x1e, 0x29, 0x34, 0x3f, 0x4a, 0x55, 0x60, 0x6b, 0x76, 0x82, 0x8d, 0x98,
+        0x42, 0x4d, 0x58, 0x63, 0x6e, 0x79, 0x85, 0x90, 0x9b, 0xa6, 0xb1, 0xbc, 0xc7, 0xd2, 0xdd, 0xe8,
+        0xf3, 0xfe, 0x09, 0x14, 0x1f, 0x2a, 0x35, 0x40, 0x4b, 0x56, 0x61, 0x6c, 0x77, 0x83, 0x8e, 0x99,
+        0xa4, 0xaf, 0xba, 0xc5, 0xd0, 0xdb, 0xe6, 0xf1, 0xfc, 0x07, 0x12, 0x1d, 0x28, 0x33, 0x3e, 0x49,
+        0x54, 0x5f, 0x6a, 0x75, 0x81, 0x8c, 0x97, 0xa2, 0xad, 0xb8, 0xc3, 0xce, 0xd9, 0xe4, 0xef, 0xfa,
+        0x05, 0x10, 0x1b, 0x26, 0x31, 0x3c, 0x47, 0x52, 0x5d, 0x68, 0x73, 0x7e, 0x8a, 0x95, 0xa0, 0xab,
+        0xb6, 0xc1, 0xcc, 0xd7, 0xe2, 0xed, 0xf8, 0x03, 0x0e, 0x19, 0x24, 0x2f, 0x3a, 0x45, 0x50, 0x5b,
+        0x66, 0x71, 0x7c, 0x88, 0x93, 0x9e, 0xa9, 0xb4, 0xbf, 0xca, 0xd5, 0xe0, 0xeb, 0xf6, 0x01, 0x0c,
+        0x17, 0x22, 0x2d, 0x38, 0x43, 0x4e, 0x59, 0x64, 0x6f, 0x7a, 0x86, 0x91, 0x9c, 0xa7, 0xb2, 0xbd,
+        0x67, 0x72, 0x7d, 0x89, 0x94, 0x9f, 0xaa, 0xb5, 0xc0, 0xcb, 0xd6, 0xe1, 0xec, 0xf7, 0x02, 0x0d,
+        0x18, 0x23, 0x2e, 0x39, 0x44, 0x4f, 0x5a, 0x65, 0x70, 0x7b, 0x87, 0x92, 0x9d, 0xa8, 0xb3, 0xbe,
+        0xc9, 0xd4, 0xdf, 0xea, 0xf5, 0x00, 0x0b, 0x16, 0x21, 0x2c, 0x37, 0x42, 0x4d, 0x58, 0x63, 0x6e,
+        0x79, 0x85, 0x90, 0x9b, 0xa6, 0xb1, 0xbc, 0xc7, 0xd2, 0xdd, 0xe8, 0xf3, 0xfe, 0x09, 0x14, 0x1f,
+        0x2a, 0x35, 0x40, 0x4b, 0x56, 0x61, 0x6c, 0x77, 0x83, 0x8e, 0x99, 0xa4, 0xaf, 0xba, 0xc5, 0xd0,
+        0xdb, 0xe6, 0xf1, 0xfc, 0x07, 0x12, 0x1d, 0x28, 0x33, 0x3e, 0x49, 0x54, 0x5f, 0x6a, 0x75, 0x81,
+        0x8c, 0x97, 0xa2, 0xad, 0xb8, 0xc3, 0xce, 0xd9, 0xe4, 0xef, 0xfa, 0x05, 0x10, 0x1b, 0x26, 0x31,
+        0x3c, 0x47, 0x52, 0x5d, 0x68, 0x73, 0x7e, 0x8a, 0x95, 0xa0, 0xab, 0xb6, 0xc1, 0xcc, 0xd7, 0xe2,
+        0x8d, 0x98, 0xa3, 0xae, 0xb9, 0xc4, 0xcf, 0xda, 0xe5, 0xf0, 0xfb, 0x06, 0x11, 0x1c, 0x27, 0x32,
+        0x3d, 0x48, 0x53, 0x5e, 0x69, 0x74, 0x7f, 0x8b, 0x96, 0xa1, 0xac, 0xb7, 0xc2, 0xcd, 0xd8, 0xe3,
+        0xee, 0xf9, 0x04, 0x0f, 0x1a, 0x25, 0x30, 0x3b, 0x46, 0x51, 0x5c, 0x67, 0x72, 0x7d, 0x89, 0x94,
+        0x9f, 0xaa, 0xb5, 0xc0, 0xcb, 0xd6, 0xe1, 0xec, 0xf7, 0x02, 0x0d, 0x18, 0x23, 0x2e, 0x39, 0x44,
+        0x4f, 0x5a, 0x65, 0x70, 0x7b, 0x87, 0x92, 0x9d, 0xa8, 0xb3, 0xbe, 0xc9, 0xd4, 0xdf, 0xea, 0xf5,
+        0x00, 0x0b, 0x16, 0x21, 0x2c, 0x37, 0x42, 0x4d, 0x58, 0x63, 0x6e, 0x79, 0x85, 0x90, 0x9b, 0xa6,
+        0xb1, 0xbc, 0xc7, 0xd2, 0xdd, 0xe8, 0xf3, 0xfe, 0x09, 0x14, 0x1f, 0x2a, 0x35, 0x40, 0x4b, 0x56,
+        0x61, 0x6c, 0x77, 0x83, 0x8e, 0x99, 0xa4, 0xaf, 0xba, 0xc5, 0xd0, 0xdb, 0xe6, 0xf1, 0xfc, 0x07,
+        0xb2, 0xbd, 0xc8, 0xd3, 0xde, 0xe9, 0xf4, 0xff, 0x0a, 0x15, 0x20, 0x2b, 0x36, 0x41, 0x4c, 0x57,
+        0x62, 0x6d, 0x78, 0x84, 0x8f, 0x9a, 0xa5, 0xb0, 0xbb, 0xc6, 0xd1, 0xdc, 0xe7, 0xf2, 0xfd, 0x08,
+        0x13, 0x1e, 0x29, 0x34, 0x3f, 0x4a, 0x55, 0x60, 0x6b, 0x76, 0x82, 0x8d, 0x98, 0xa3, 0xae, 0xb9,
+        0xc4, 0xcf, 0xda, 0xe5, 0xf0, 0xfb, 0x06, 0x11, 0x1c, 0x27, 0x32, 0x3d, 0x48, 0x53, 0x5e, 0x69,
+        0x74, 0x7f, 0x8b, 0x96, 0xa1, 0xac, 0xb7, 0xc2, 0xcd, 0xd8, 0xe3, 0xee, 0xf9, 0x04, 0x0f, 0x1a,
+        0x25, 0x30, 0x3b, 0x46, 0x51, 0x5c, 0x67, 0x72, 0x7d, 0x89, 0x94, 0x9f, 0xaa, 0xb5, 0xc0, 0xcb,
+        0xd6, 0xe1, 0xec, 0xf7, 0x02, 0x0d, 0x18, 0x23, 0x2e, 0x39, 0x44, 0x4f, 0x5a, 0x65, 0x70, 0x7b,
+        0x87, 0x92, 0x9d, 0xa8, 0xb3, 0xbe, 0xc9, 0xd4, 0xdf, 0xea, 0xf5, 0x00, 0x0b, 0x16, 0x21, 0x2c,
+        0xd7, 0xe2, 0xed, 0xf8, 0x03, 0x0e, 0x19, 0x24, 0x2f, 0x3a, 0x45, 0x50, 0x5b, 0x66, 0x71, 0x7c,
+        0x88, 0x93, 0x9e, 0xa9, 0xb4, 0xbf, 0xca, 0xd5, 0xe0, 0xeb, 0xf6, 0x01, 0x0c, 0x17, 0x22, 0x2d,
+        0x38, 0x43, 0x4e, 0x59, 0x64, 0x6f, 0x7a, 0x86, 0x91, 0x9c, 0xa7, 0xb2, 0xbd, 0xc8, 0xd3, 0xde,
+        0xe9, 0xf4, 0xff, 0x0a, 0x15, 0x20, 0x2b, 0x36, 0x41, 0x4c, 0x57, 0x62, 0x6d, 0x78, 0x84, 0x8f,
+        0x9a, 0xa5, 0xb0, 0xbb, 0xc6, 0xd1, 0xdc, 0xe7, 0xf2, 0xfd, 0x08, 0x13, 0x1e, 0x29, 0x34, 0x3f,
+        0x4a, 0x55, 0x60, 0x6b, 0x76, 0x82, 0x8d, 0x98, 0xa3, 0xae, 0xb9, 0xc4, 0xcf, 0xda, 0xe5, 0xf0,
+        0xfb, 0x06, 0x11, 0x1c, 0x27, 0x32, 0x3d, 0x48, 0x53, 0x5e, 0x69, 0x74, 0x7f, 0x8b, 0x96, 0xa1,
+        0xac, 0xb7, 0xc2, 0xcd, 0xd8, 0xe3, 0xee, 0xf9, 0x04, 0x0f, 0x1a, 0x25, 0x30, 0x3b, 0x46, 0x51,
+        0xfc, 0x07, 0x12, 0x1d, 0x28, 0x33, 0x3e, 0x49, 0x54, 0x5f, 0x6a, 0x75, 0x81, 0x8c, 0x97, 0xa2,
+        0xad, 0xb8, 0xc3, 0xce, 0xd9, 0xe4, 0xef, 0xfa, 0x05, 0x10, 0x1b, 0x26, 0x31, 0x3c, 0x47, 0x52,
+        0x5d, 0x68, 0x73, 0x7e, 0x8a, 0x95, 0xa0, 0xab, 0xb6, 0xc1, 0xcc, 0xd7, 0xe2, 0xed, 0xf8, 0x03,
+        0x0e, 0x19, 0x24, 0x2f, 0x3a, 0x45, 0x50, 0x5b, 0x66, 0x71, 0x7c, 0x88, 0x93, 0x9e, 0xa9, 0xb4,
+        0xbf, 0xca, 0xd5, 0xe0, 0xeb, 0xf6, 0x01, 0x0c, 0x17, 0x22, 0x2d, 0x38, 0x43, 0x4e, 0x59, 0x64,
+        0x6f, 0x7a, 0x86, 0x91, 0x9c, 0xa7, 0xb2, 0xbd, 0xc8, 0xd3, 0xde, 0xe9, 0xf4, 0xff, 0x0a, 0x15,
+        0x20, 0x2b, 0x36, 0x41, 0x4c, 0x57, 0x62, 0x6d, 0x78, 0x84, 0x8f, 0x9a, 0xa5, 0xb0, 0xbb, 0xc6,
+        0xd1, 0xdc, 0xe7, 0xf2, 0xfd, 0x08, 0x13, 0x1e, 0x29, 0x34, 0x3f, 0x4a, 0x55, 0x60, 0x6b, 0x76,
+        0x21, 0x2c, 0x37, 0x42, 0x4d, 0x58, 0x63, 0x6e, 0x79, 0x85, 0x90, 0x9b, 0xa6, 0xb1, 0xbc, 0xc7,
+        0xd2, 0xdd, 0xe8, 0xf3, 0xfe, 0x09, 0x14, 0x1f, 0x2a, 0x35, 0x40, 0x4b, 0x56, 0x61, 0x6c, 0x77,
+        0x83, 0x8e, 0x99, 0xa4, 0xaf, 0xba, 0xc5, 0xd0, 0xdb, 0xe6, 0xf1, 0xfc, 0x07, 0x12, 0x1d, 0x28,
+        0x33, 0x3e, 0x49, 0x54, 0x5f, 0x6a, 0x75, 0x81, 0x8c, 0x97, 0xa2, 0xad, 0xb8, 0xc3, 0xce, 0xd9,
+        0xe4, 0xef, 0xfa, 0x05, 0x10, 0x1b, 0x26, 0x31, 0x3c, 0x47, 0x52, 0x5d, 0x68, 0x73, 0x7e, 0x8a,
+        0x95, 0xa0, 0xab, 0xb6, 0xc1, 0xcc, 0xd7, 0xe2, 0xed, 0xf8, 0x03, 0x0e, 0x19, 0x24, 0x2f, 0x3a,
+        0x45, 0x50, 0x5b, 0x66, 0x71, 0x7c, 0x88, 0x93, 0x9e, 0xa9, 0xb4, 0xbf, 0xca, 0xd5, 0xe0, 0xeb,
+        0xf6, 0x01, 0x0c, 0x17, 0x22, 0x2d, 0x38, 0x43, 0x4e, 0x59, 0x64, 0x6f, 0x7a, 0x86, 0x91, 0x9c,
+        0x46, 0x51, 0x5c, 0x67, 0x72, 0x7d, 0x89, 0x94, 0x9f, 0xaa, 0xb5, 0xc0, 0xcb, 0xd6, 0xe1, 0xec,
+        0xf7, 0x02, 0x0d, 0x18, 0x23, 0x2e, 0x39, 0x44, 0x4f, 0x5a, 0x65, 0x70, 0x7b, 0x87, 0x92, 0x9d,
+        0xa8, 0xb3, 0xbe, 0xc9, 0xd4, 0xdf, 0xea, 0xf5, 0x00, 0x0b, 0x16, 0x21, 0x2c, 0x37, 0x42, 0x4d,
+        0x58, 0x63, 0x6e, 0x79, 0x85, 0x90, 0x9b, 0xa6, 0xb1, 0xbc, 0xc7, 0xd2, 0xdd, 0xe8, 0xf3, 0xfe,
+        0x09, 0x14, 0x1f, 0x2a, 0x35, 0x40, 0x4b, 0x56, 0x61, 0x6c, 0x77, 0x83, 0x8e, 0x99, 0xa4, 0xaf,
+        0xba, 0xc5, 0xd0, 0xdb, 0xe6, 0xf1, 0xfc, 0x07, 0x12, 0x1d, 0x28, 0x33, 0x3e, 0x49, 0x54, 0x5f,
+        0x6a, 0x75, 0x81, 0x8c, 0x97, 0xa2, 0xad, 0xb8, 0xc3, 0xce, 0xd9, 0xe4, 0xef, 0xfa, 0x05, 0x10,
+        0x1b, 0x26, 0x31, 0x3c, 0x47, 0x52, 0x5d, 0x68, 0x73, 0x7e, 0x8a, 0x95, 0xa0, 0xab, 0xb6, 0xc1,
+        0x6b, 0x76, 0x82, 0x8d, 0x98, 0xa3, 0xae, 0xb9, 0xc4, 0xcf, 0xda, 0xe5, 0xf0, 0xfb, 0x06, 0x11,
+        0x1c, 0x27, 0x32, 0x3d, 0x48, 0x53, 0x5e, 0x69, 0x74, 0x7f, 0x8b, 0x96, 0xa1, 0xac, 0xb7, 0xc2,
+        0xcd, 0xd8, 0xe3, 0xee, 0xf9, 0x04, 0x0f, 0x1a, 0x25, 0x30, 0x3b, 0x46, 0x51, 0x5c, 0x67, 0x72,
+        0x7d, 0x89, 0x94, 0x9f, 0xaa, 0xb5, 0xc0, 0xcb, 0xd6, 0xe1, 0xec, 0xf7, 0x02, 0x0d, 0x18, 0x23,
+        0x2e, 0x39, 0x44, 0x4f, 0x5a, 0x65, 0x70, 0x7b, 0x87, 0x92, 0x9d, 0xa8, 0xb3, 0xbe, 0xc9, 0xd4,
+        0xdf, 0xea, 0xf5, 0x00, 0x0b, 0x16, 0x21, 0x2c, 0x37, 0x42, 0x4d, 0x58, 0x63, 0x6e, 0x79, 0x85,
+        0x90, 0x9b, 0xa6, 0xb1, 0xbc, 0xc7, 0xd2, 0xdd, 0xe8, 0xf3, 0xfe, 0x09, 0x14, 0x1f, 0x2a, 0x35,
+        0x40, 0x4b, 0x56, 0x61, 0x6c, 0x77, 0x83, 0x8e, 0x99, 0xa4, 0xaf, 0xba, 0xc5, 0xd0, 0xdb, 0xe6,
+        0x91, 0x9c, 0xa7, 0xb2, 0xbd, 0xc8, 0xd3, 0xde, 0xe9, 0xf4, 0xff, 0x0a, 0x15, 0x20, 0x2b, 0x36,
+        0x41, 0x4c, 0x57, 0x62, 0x6d, 0x78, 0x84, 0x8f, 0x9a, 0xa5, 0xb0, 0xbb, 0xc6, 0xd1, 0xdc, 0xe7,
+        0xf2, 0xfd, 0x08, 0x13, 0x1e, 0x29, 0x34, 0x3f, 0x4a, 0x55, 0x60, 0x6b, 0x76, 0x82, 0x8d, 0x98,
+        0xa3, 0xae, 0xb9, 0xc4, 0xcf, 0xda, 0xe5, 0xf0, 0xfb, 0x06, 0x11, 0x1c, 0x27, 0x32, 0x3d, 0x48,
+        0x53, 0x5e, 0x69, 0x74, 0x7f, 0x8b, 0x96, 0xa1, 0xac, 0xb7, 0xc2, 0xcd, 0xd8, 0xe3, 0xee, 0xf9,
+        0x04, 0x0f, 0x1a, 0x25, 0x30, 0x3b, 0x46, 0x51, 0x5c, 0x67, 0x72, 0x7d, 0x89, 0x94, 0x9f, 0xaa,
+        0xb5, 0xc0, 0xcb, 0xd6, 0xe1, 0xec, 0xf7, 0x02, 0x0d, 0x18, 0x23, 0x2e, 0x39, 0x44, 0x4f, 0x5a,
+        0x65, 0x70, 0x7b, 0x87, 0x92, 0x9d, 0xa8, 0xb3, 0xbe, 0xc9, 0xd4, 0xdf, 0xea, 0xf5, 0x00, 0x0b,
+        0xb6, 0xc1, 0xcc, 0xd7, 0xe2, 0xed, 0xf8, 0x03, 0x0e, 0x19, 0x24, 0x2f, 0x3a, 0x45, 0x50, 0x5b,
+        0x66, 0x71, 0x7c, 0x88, 0x93, 0x9e, 0xa9, 0xb4, 0xbf, 0xca, 0xd5, 0xe0, 0xeb, 0xf6, 0x01, 0x0c,
+        0x17, 0x22, 0x2d, 0x38, 0x43, 0x4e, 0x59, 0x64, 0x6f, 0x7a, 0x86, 0x91, 0x9c, 0xa7, 0xb2, 0xbd,
+        0xc8, 0xd3, 0xde, 0xe9, 0xf4, 0xff, 0x0a, 0x15, 0x20, 0x2b, 0x36, 0x41, 0x4c, 0x57, 0x62, 0x6d,
+        0x78, 0x84, 0x8f, 0x9a, 0xa5, 0xb0, 0xbb, 0xc6, 0xd1, 0xdc, 0xe7, 0xf2, 0xfd, 0x08, 0x13, 0x1e,
+        0x29, 0x34, 0x3f, 0x4a, 0x55, 0x60, 0x6b, 0x76, 0x82, 0x8d, 0x98, 0xa3, 0xae, 0xb9, 0xc4, 0xcf,
+        0xda, 0xe5, 0xf0, 0xfb, 0x06, 0x11, 0x1c, 0x27, 0x32, 0x3d, 0x48, 0x53, 0x5e, 0x69, 0x74, 0x7f,
+        0x8b, 0x96, 0xa1, 0xac, 0xb7, 0xc2, 0xcd, 0xd8, 0xe3, 0xee, 0xf9, 0x04, 0x0f, 0x1a, 0x25, 0x30,
+        0xdb, 0xe6, 0xf1, 0xfc, 0x07, 0x12, 0x1d, 0x28, 0x33, 0x3e, 0x49, 0x54, 0x5f, 0x6a, 0x75, 0x81,
+        0x8c, 0x97, 0xa2, 0xad, 0xb8, 0xc3, 0xce, 0xd9, 0xe4, 0xef, 0xfa, 0x05, 0x10, 0x1b, 0x26, 0x31,
+        0x3c, 0x47, 0x52, 0x5d, 0x68, 0x73, 0x7e, 0x8a, 0x95, 0xa0, 0xab, 0xb6, 0xc1, 0xcc, 0xd7, 0xe2,
+        0xed, 0xf8, 0x03, 0x0e, 0x19, 0x24, 0x2f, 0x3a, 0x45, 0x50, 0x5b, 0x66, 0x71, 0x7c, 0x88, 0x93,
+        0x9e, 0xa9, 0xb4, 0xbf, 0xca, 0xd5, 0xe0, 0xeb, 0xf6, 0x01, 0x0c, 0x17, 0x22, 0x2d, 0x38, 0x43,
+        0x4e, 0x59, 0x64, 0x6f, 0x7a, 0x86, 0x91, 0x9c, 0xa7, 0xb2, 0xbd, 0xc8, 0xd3, 0xde, 0xe9, 0xf4,
+        0xff, 0x0a, 0x15, 0x20, 0x2b, 0x36, 0x41, 0x4c, 0x57, 0x62, 0x6d, 0x78, 0x84, 0x8f, 0x9a, 0xa5,
+        0xb0, 0xbb, 0xc6, 0xd1, 0xdc, 0xe7, 0xf2, 0xfd, 0x08, 0x13, 0x1e, 0x29, 0x34, 0x3f, 0x4a, 0x55,
+        0x00, 0x0b, 0x16, 0x21, 0x2c, 0x37, 0x42, 0x4d, 0x58, 0x63, 0x6e, 0x79, 0x85, 0x90, 0x9b, 0xa6,
+        0xb1, 0xbc, 0xc7, 0xd2, 0xdd, 0xe8, 0xf3, 0xfe, 0x09, 0x14, 0x1f, 0x2a, 0x35, 0x40, 0x4b, 0x56,
+        0x61, 0x6c, 0x77, 0x83, 0x8e, 0x99, 0xa4, 0xaf, 0xba, 0xc5, 0xd0, 0xdb, 0xe6, 0xf1, 0xfc, 0x07,
+        0x12, 0x1d, 0x28, 0x33, 0x3e, 0x49, 0x54, 0x5f, 0x6a, 0x75, 0x81, 0x8c, 0x97, 0xa2, 0xad, 0xb8,
+        0xc3, 0xce, 0xd9, 0xe4, 0xef, 0xfa, 0x05, 0x10, 0x1b, 0x26, 0x31, 0x3c, 0x47, 0x52, 0x5d, 0x68,
+        0x73, 0x7e, 0x8a, 0x95, 0xa0, 0xab, 0xb6, 0xc1, 0xcc, 0xd7, 0xe2, 0xed, 0xf8, 0x03, 0x0e, 0x19,
+        0x24, 0x2f, 0x3a, 0x45, 0x50, 0x5b, 0x66, 0x71, 0x7c, 0x88, 0x93, 0x9e, 0xa9, 0xb4, 0xbf, 0xca,
+        0xd5, 0xe0, 0xeb, 0xf6, 0x01, 0x0c, 0x17, 0x22, 0x2d, 0x38, 0x43, 0x4e, 0x59, 0x64, 0x6f, 0x7a
+    },
+    {
+        0x06, 0x11, 0x1c, 0x27, 0x32, 0x3d, 0x48, 0x53, 0x5e, 0x69, 0x74, 0x7f, 0x8b, 0x96, 0xa1, 0xac,
+        0xb7, 0xc2, 0xcd, 0xd8, 0xe3, 0xee, 0xf9, 0x04, 0x0f, 0x1a, 0x25, 0x30, 0x3b, 0x46, 0x51, 0x5c,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x2b, 0x36, 0x41, 0x4c, 0x57, 0x62, 0x6d, 0x78, 0x84, 0x8f, 0x9a, 0xa5, 0xb0, 0xbb, 0xc6, 0xd1,
+        0xdc, 0xe7, 0xf2, 0xfd, 0x08, 0x13, 0x1e, 0x29, 0x34, 0x3f, 0x4a, 0x55, 0x60, 0x6b, 0x76, 0x82,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x50, 0x5b, 0x66, 0x71, 0x7c, 0x88, 0x93, 0x9e, 0xa9, 0xb4, 0xbf, 0xca, 0xd5, 0xe0, 0xeb, 0xf6,
+        0x01, 0x0c, 0x17, 0x22, 0x2d, 0x38, 0x43, 0x4e, 0x59, 0x64, 0x6f, 0x7a, 0x86, 0x91, 0x9c, 0xa7,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x75, 0x81, 0x8c, 0x97, 0xa2, 0xad, 0xb8, 0xc3, 0xce, 0xd9, 0xe4, 0xef, 0xfa, 0x05, 0x10, 0x1b,
+        0x26, 0x31, 0x3c, 0x47, 0x52, 0x5d, 0x68, 0x73, 0x7e, 0x8a, 0x95, 0xa0, 0xab, 0xb6, 0xc1, 0xcc,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x9b, 0xa6, 0xb1, 0xbc, 0xc7, 0xd2, 0xdd, 0xe8, 0xf3, 0xfe, 0x09, 0x14, 0x1f, 0x2a, 0x35, 0x40,
+        0x4b, 0x56, 0x61, 0x6c, 0x77, 0x83, 0x8e, 0x99, 0xa4, 0xaf, 0xba, 0xc5, 0xd0, 0xdb, 0xe6, 0xf1,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xc0, 0xcb, 0xd6, 0xe1, 0xec, 0xf7, 0x02, 0x0d, 0x18, 0x23, 0x2e, 0x39, 0x44, 0x4f, 0x5a, 0x65,
+        0x70, 0x7b, 0x87, 0x92, 0x9d, 0xa8, 0xb3, 0xbe, 0xc9, 0xd4, 0xdf, 0xea, 0xf5, 0x00, 0x0b, 0x16,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xe5, 0xf0, 0xfb, 0x06, 0x11, 0x1c, 0x27, 0x32, 0x3d, 0x48, 0x53, 0x5e, 0x69, 0x74, 0x7f, 0x8b,
+        0x96, 0xa1, 0xac, 0xb7, 0xc2, 0xcd, 0xd8, 0xe3, 0xee, 0xf9, 0x04, 0x0f, 0x1a, 0x25, 0x30, 0x3b,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x0a, 0x15, 0x20, 0x2b, 0x36, 0x41, 0x4c, 0x57, 0x62, 0x6d, 0x78, 0x84, 0x8f, 0x9a, 0xa5, 0xb0,
+        0xbb, 0xc6, 0xd1, 0xdc, 0xe7, 0xf2, 0xfd, 0x08, 0x13, 0x1e, 0x29, 0x34, 0x3f, 0x4a, 0x55, 0x60,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x2f, 0x3a, 0x45, 0x50, 0x5b, 0x66, 0x71, 0x7c, 0x88, 0x93, 0x9e, 0xa9, 0xb4, 0xbf, 0xca, 0xd5,
+        0xe0, 0xeb, 0xf6, 0x01, 0x0c, 0x17, 0x22, 0x2d, 0x38, 0x43, 0x4e, 0x59, 0x64, 0x6f, 0x7a, 0x86,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x54, 0x5f, 0x6a, 0x75, 0x81, 0x8c, 0x97, 0xa2, 0xad, 0xb8, 0xc3, 0xce, 0xd9, 0xe4, 0xef, 0xfa,
+        0x05, 0x10, 0x1b, 0x26, 0x31, 0x3c, 0x47, 0x52, 0x5d, 0x68, 0x73, 0x7e, 0x8a, 0x95, 0xa0, 0xab,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x79, 0x85, 0x90, 0x9b, 0xa6, 0xb1, 0xbc, 0xc7, 0xd2, 0xdd, 0xe8, 0xf3, 0xfe, 0x09, 0x14, 0x1f,
+        0x2a, 0x35, 0x40, 0x4b, 0x56, 0x61, 0x6c, 0x77, 0x83, 0x8e, 0x99, 0xa4, 0xaf, 0xba, 0xc5, 0xd0,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x9f, 0xaa, 0xb5, 0xc0, 0xcb, 0xd6, 0xe1, 0xec, 0xf7, 0x02, 0x0d, 0x18, 0x23, 0x2e, 0x39, 0x44,
+        0x4f, 0x5a, 0x65, 0x70, 0x7b, 0x87, 0x92, 0x9d, 0xa8, 0xb3, 0xbe, 0xc9, 0xd4, 0xdf, 0xea, 0xf5,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xc4, 0xcf, 0xda, 0xe5, 0xf0, 0xfb, 0x06, 0x11, 0x1c, 0x27, 0x32, 0x3d, 0x48, 0x53, 0x5e, 0x69,
+        0x74, 0x7f, 0x8b, 0x96, 0xa1, 0xac, 0xb7, 0xc2, 0xcd, 0xd8, 0xe3, 0xee, 0xf9, 0x04, 0x0f, 0x1a,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xe9, 0xf4, 0xff, 0x0a, 0x15, 0x20, 0x2b, 0x36, 0x41, 0x4c, 0x57, 0x62, 0x6d, 0x78, 0x84, 0x8f,
+        0x9a, 0xa5, 0xb0, 0xbb, 0xc6, 0xd1, 0xdc, 0xe7, 0xf2, 0xfd, 0x08, 0x13, 0x1e, 0x29, 0x34, 0x3f,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x0e, 0x19, 0x24, 0x2f, 0x3a, 0x45, 0x50, 0x5b, 0x66, 0x71, 0x7c, 0x88, 0x93, 0x9e, 0xa9, 0xb4,
+        0xbf, 0xca, 0xd5, 0xe0, 0xeb, 0xf6, 0x01, 0x0c, 0x17, 0x22, 0x2d, 0x38, 0x43, 0x4e, 0x59, 0x64,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x33, 0x3e, 0x49, 0x54, 0x5f, 0x6a, 0x75, 0x81, 0x8c, 0x97, 0xa2, 0xad, 0xb8, 0xc3, 0xce, 0xd9,
+        0xe4, 0xef, 0xfa, 0x05, 0x10, 0x1b, 0x26, 0x31, 0x3c, 0x47, 0x52, 0x5d, 0x68, 0x73, 0x7e, 0x8a,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x58, 0x63, 0x6e, 0x79, 0x85, 0x90, 0x9b, 0xa6, 0xb1, 0xbc, 0xc7, 0xd2, 0xdd, 0xe8, 0xf3, 0xfe,
+        0x09, 0x14, 0x1f, 0x2a, 0x35, 0x40, 0x4b, 0x56, 0x61, 0x6c, 0x77, 0x83, 0x8e, 0x99, 0xa4, 0xaf,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x7d, 0x89, 0x94, 0x9f, 0xaa, 0xb5, 0xc0, 0xcb, 0xd6, 0xe1, 0xec, 0xf7, 0x02, 0x0d, 0x18, 0x23,
+        0x2e, 0x39, 0x44, 0x4f, 0x5a, 0x65, 0x70, 0x7b, 0x87, 0x92, 0x9d, 0xa8, 0xb3, 0xbe, 0xc9, 0xd4,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xa3, 0xae, 0xb9, 0xc4, 0xcf, 0xda, 0xe5, 0xf0, 0xfb, 0x06, 0x11, 0x1c, 0x27, 0x32, 0x3d, 0x48,
+        0x53, 0x5e, 0x69, 0x74, 0x7f, 0x8b, 0x96, 0xa1, 0xac, 0xb7, 0xc2, 0xcd, 0xd8, 0xe3, 0xee, 0xf9,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xc8, 0xd3, 0xde, 0xe9, 0xf4, 0xff, 0x0a, 0x15, 0x20, 0x2b, 0x36, 0x41, 0x4c, 0x57, 0x62, 0x6d,
+        0x78, 0x84, 0x8f, 0x9a, 0xa5, 0xb0, 0xbb, 0xc6, 0xd1, 0xdc, 0xe7, 0xf2, 0xfd, 0x08, 0x13, 0x1e,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xed, 0xf8, 0x03, 0x0e, 0x19, 0x24, 0x2f, 0x3a, 0x45, 0x50, 0x5b, 0x66, 0x71, 0x7c, 0x88, 0x93,
+        0x9e, 0xa9, 0xb4, 0xbf, 0xca, 0xd5, 0xe0, 0xeb, 0xf6, 0x01, 0x0c, 0x17, 0x22, 0x2d, 0x38, 0x43,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x12, 0x1d, 0x28, 0x33, 0x3e, 0x49, 0x54, 0x5f, 0x6a, 0x75, 0x81, 0x8c, 0x97, 0xa2, 0xad, 0xb8,
+        0xc3, 0xce, 0xd9, 0xe4, 0xef, 0xfa, 0x05, 0x10, 0x1b, 0x26, 0x31, 0x3c, 0x47, 0x52, 0x5d, 0x68,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x37, 0x42, 0x4d, 0x58, 0x63, 0x6e, 0x79, 0x85, 0x90, 0x9b, 0xa6, 0xb1, 0xbc, 0xc7, 0xd2, 0xdd,
+        0xe8, 0xf3, 0xfe, 0x09, 0x14, 0x1f, 0x2a, 0x35, 0x40, 0x4b, 0x56, 0x61, 0x6c, 0x77, 0x83, 0x8e,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x5c, 0x67, 0x72, 0x7d, 0x89, 0x94, 0x9f, 0xaa, 0xb5, 0xc0, 0xcb, 0xd6, 0xe1, 0xec, 0xf7, 0x02,
+        0x0d, 0x18, 0x23, 0x2e, 0x39, 0x44, 0x4f, 0x5a, 0x65, 0x70, 0x7b, 0x87, 0x92, 0x9d, 0xa8, 0xb3,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x82, 0x8d, 0x98, 0xa3, 0xae, 0xb9, 0xc4, 0xcf, 0xda, 0xe5, 0xf0, 0xfb, 0x06, 0x11, 0x1c, 0x27,
+        0x32, 0x3d, 0x48, 0x53, 0x5e, 0x69, 0x74, 0x7f, 0x8b, 0x96, 0xa1, 0xac, 0xb7, 0xc2, 0xcd, 0xd8,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xa7, 0xb2, 0xbd, 0xc8, 0xd3, 0xde, 0xe9, 0xf4, 0xff, 0x0a, 0x15, 0x20, 0x2b, 0x36, 0x41, 0x4c,
+        0x57, 0x62, 0x6d, 0x78, 0x84, 0x8f, 0x9a, 0xa5, 0xb0, 0xbb, 0xc6, 0xd1, 0xdc, 0xe7, 0xf2, 0xfd,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xcc, 0xd7, 0xe2, 0xed, 0xf8, 0x03, 0x0e, 0x19, 0x24, 0x2f, 0x3a, 0x45, 0x50, 0x5b, 0x66, 0x71,
+        0x7c, 0x88, 0x93, 0x9e, 0xa9, 0xb4, 0xbf, 0xca, 0xd5, 0xe0, 0xeb, 0xf6, 0x01, 0x0c, 0x17, 0x22,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xf1, 0xfc, 0x07, 0x12, 0x1d, 0x28, 0x33, 0x3e, 0x49, 0x54, 0x5f, 0x6a, 0x75, 0x81, 0x8c, 0x97,
+        0xa2, 0xad, 0xb8, 0xc3, 0xce, 0xd9, 0xe4, 0xef, 0xfa, 0x05, 0x10, 0x1b, 0x26, 0x31, 0x3c, 0x47,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x16, 0x21, 0x2c, 0x37, 0x42, 0x4d, 0x58, 0x63, 0x6e, 0x79, 0x85, 0x90, 0x9b, 0xa6, 0xb1, 0xbc,
+        0xc7, 0xd2, 0xdd, 0xe8, 0xf3, 0xfe, 0x09, 0x14, 0x1f, 0x2a, 0x35, 0x40, 0x4b, 0x56, 0x61, 0x6c,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x3b, 0x46, 0x51, 0x5c, 0x67, 0x72, 0x7d, 0x89, 0x94, 0x9f, 0xaa, 0xb5, 0xc0, 0xcb, 0xd6, 0xe1,
+        0xec, 0xf7, 0x02, 0x0d, 0x18, 0x23, 0x2e, 0x39, 0x44, 0x4f, 0x5a, 0x65, 0x70, 0x7b, 0x87, 0x92,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x60, 0x6b, 0x76, 0x82, 0x8d, 0x98, 0xa3, 0xae, 0xb9, 0xc4, 0xcf, 0xda, 0xe5, 0xf0, 0xfb, 0x06,
+        0x11, 0x1c, 0x27, 0x32, 0x3d, 0x48, 0x53, 0x5e, 0x69, 0x74, 0x7f, 0x8b, 0x96, 0xa1, 0xac, 0xb7,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x86, 0x91, 0x9c, 0xa7, 0xb2, 0xbd, 0xc8, 0xd3, 0xde, 0xe9, 0xf4, 0xff, 0x0a, 0x15, 0x20, 0x2b,
+        0x36, 0x41, 0x4c, 0x57, 0x62, 0x6d, 0x78, 0x84, 0x8f, 0x9a, 0xa5, 0xb0, 0xbb, 0xc6, 0xd1, 0xdc,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    }
+};
+
+// Tail mask of every K tile (dimc_set_mct)
+static const uint8_t dense_mct[2] = {
+    0, 192
+};
+
+// Partial sum input (ADDIN) of every output channel
+static const int32_t dense_bias[32] __attribute__((aligned(32), section(".data"))) = {
+    -16000, -15000, -14000, -13000, -12000, -11000, -10000, -9000, -8000, -7000, -6000, -5000, -4000, -3000, -2000, -1000,
+    0, 1000, 2000, 3000, 4000, 5000, 6000, 7000, 8000, 9000, 10000, 11000, 12000, 13000, 14000, 15000
+};
@@ -0,0 +1,94 @@
+// Copyright 2020 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "benchmark.c"
+#include <snrt.h>
+#include "printf.h"
+#include "int8_gemm.h"
+
+// Shapes covering each backend of the front-end: a small problem that does
+// not amortize the DIMC weight load, a deep weight-stationary one, and a
+// shallow one whose ragged column tail is cheaper on the vector kernel. The
+// last one has an odd row count, which leaves a row for the 1xVL kernel.
+typedef struct {
+    uint32_t M, N, K;
+} gemm_shape_t;
+
+static const gemm_shape_t shapes[] = {
+    {8, 20, 24},
+    {32, 64, 256},
+    {16, 72, 32},
+    {7, 16, 40},
+};
+
+static const char *backend_name[] = {"vector", "dimc", "split"};
+
+static uint32_t lcg_state = 42;
+
+static inline int8_t lcg_next() {
+    lcg_state = lcg_state * 1664525u + 1013904223u;
+    return (int8_t)(lcg_state >> 24);
+}
+
+static int verify(const int32_t *c, const int8_t *a, const int8_t *b,
+                  uint32_t M, uint32_t N, uint32_t K) {
+    int errors = 0;
+    for (uint32_t m = 0; m < M; ++m)
+        for (uint32_t n = 0; n < N; ++n) {
+            int32_t golden = 0;
+            for (uint32_t k = 0; k < K; ++k)
+                golden += (int32_t)a[m * K + k] * (int32_t)b[k * N + n];
+            if (c[m * N + n] != golden) {
+                if (errors < 4)
+                    printf("  c[%u][%u] = %d, expected %d\n", m, n,
+                           c[m * N + n], golden);
+                ++errors;
+            }
+        }
+    return errors;
+}
+
+int main() {
+    const unsigned int cid = snrt_cluster_core_idx();
+    int errors = 0;
+
+    if (cid == 0) {
+        int8_gemm_cost_t cost;
+        void *scratch = snrt_l1alloc(INT8_GEMM_CALIB_SCRATCH);
+        int8_gemm_calibrate(&cost, scratch);
+        printf("Calibrated: ld_k %u, dimc row %u, vector step %u/%u/%u\n",
+               cost.dimc_ld_k, cost.dimc_row, cost.vec_step[0],
+               cost.vec_step[1], cost.vec_step[2]);
+
+        // Sized for the largest shape
+        int8_t *a = (int8_t *)snrt_l1alloc(32 * 256);
+        int8_t *b = (int8_t *)snrt_l1alloc(256 * 72);
+        int32_t *c = (int32_t *)snrt_l1alloc(32 * 72 * sizeof(int32_t));
+
+        for (uint32_t s = 0; s < sizeof(shapes) / sizeof(shapes[0]); ++s) {
+            const uint32_t M = shapes[s].M, N = shapes[s].N, K = shapes[s].K;
+            for (uint32_t i = 0; i < M * K; ++i) a[i] = lcg_next();
+            for (uint32_t i = 0; i < K * N; ++i) b[i] = lcg_next();
+
+            int8_gemm_plan_t plan = int8_gemm_plan(&cost, M, N, K);
+
+            size_t timer_start = benchmark_get_cycle();
+            start_kernel();
+            int8_gemm_run(c, a, b, M, N, K, &plan);
+            stop_kernel();
+            size_t timer_end = benchmark_get_cycle();
+
+            int shape_errors = verify(c, a, b, M, N, K);
+            printf("%ux%ux%u: %s (n_dimc %u, %ux), predicted %u, took %u "
+                   "cycles, %d errors\n",
+                   M, N, K, backend_name[plan.backend], plan.n_dimc,
+                   plan.kernel_size, plan.cycles, timer_end - timer_start,
+                   shape_errors);
+            errors += shape_errors;
+        }
+    }
+
+    snrt_cluster_hw_barrier();
+    return errors;
+}
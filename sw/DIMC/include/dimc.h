@@ -0,0 +1,250 @@
+// Copyright 2020 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+#include <stdint.h>
+
+// Number of DIMC macros attached to each Spatz (cluster `n_dimc`)
+#ifndef SNRT_NDIMC_PER_CORE
+#define SNRT_NDIMC_PER_CORE 1
+#endif
+#define DIMC_NR_MACROS SNRT_NDIMC_PER_CORE
+
+// Kernel memory geometry of one macro
+#define DIMC_NR_ROWS 32
+#define DIMC_NR_SECTIONS 4
+
+// The kernel memory is split into banks of consecutive rows (cluster
+// `n_dimc_kbanks`). Kernel writes from the DMA (snrt_dimc_load_weights_async)
+// to one bank proceed while the macros compute on rows of another, so the
+// weights of the next layer can stream into one bank while the current layer
+// runs on the other. Writes to a bank the running compute still has to read,
+// anywhere in the rest of a DMV sweep, wait until the compute is done with it.
+// A DMV covers 32 / DIMC_NR_MACROS rows from its start row, so with a single
+// macro it spans all banks.
+#ifndef SNRT_DIMC_KBANKS
+#define SNRT_DIMC_KBANKS 2
+#endif
+#define DIMC_NR_KBANKS SNRT_DIMC_KBANKS
+#define DIMC_KBANK_ROWS (DIMC_NR_ROWS / DIMC_NR_KBANKS)
+
+//================================================================================
+// Instruction encoding
+//================================================================================
+
+#define DIMC_OPCODE_I 0x6B  // DMV, LD_F, LD_K, LD_KB, DPS, DSS, LD_Q, CFG
+#define DIMC_OPCODE_R 0x5F  // MACVV
+
+#define DIMC_FUNCT3_DMV 0
+#define DIMC_FUNCT3_LD_F 1
+#define DIMC_FUNCT3_LD_K 2
+#define DIMC_FUNCT3_LD_KB 3
+#define DIMC_FUNCT3_DPS 4
+#define DIMC_FUNCT3_DSS 5
+#define DIMC_FUNCT3_LD_Q 6
+#define DIMC_FUNCT3_CFG 7
+
+// Compute resolution, imm12[8:7]
+#define DIMC_MODE_1B 0
+#define DIMC_MODE_2B 1
+#define DIMC_MODE_4B 2
+#define DIMC_MODE_8B 3
+
+// Operand signedness, OR-ed into the mode (imm12[1:0] of DPS/DSS, funct7[5:4]
+// of MACVV). Signed 1-bit computes use the bipolar (+1/-1) encoding.
+#define DIMC_SIGNED_K (1 << 2)
+#define DIMC_SIGNED_F (1 << 3)
+#define DIMC_SIGNED (DIMC_SIGNED_K | DIMC_SIGNED_F)
+
+// imm12 = {flags[4:0], k_row[4:0], sec[1:0]}
+#define DIMC_IMM(flags, row, sec) \
+    ((((flags)&0x1f) << 7) | (((row)&0x1f) << 2) | ((sec)&0x3))
+
+#define DIMC_INSN_I(funct3, rd, rs1, imm)                              \
+    ((((imm)&0xfff) << 20) | (((rs1)&0x1f) << 15) | ((funct3) << 12) | \
+     (((rd)&0x1f) << 7) | DIMC_OPCODE_I)
+
+// Emit a DIMC instruction. All fields must be compile-time constants.
+#define DIMC_EMIT(insn) asm volatile(".word %0" ::"i"(insn))
+
+/// Load feature section `sec` from vector register `vs1`.
+#define dimc_ld_f(vs1, sec) \
+    DIMC_EMIT(DIMC_INSN_I(DIMC_FUNCT3_LD_F, 0, vs1, DIMC_IMM(0, 0, sec)))
+
+/// Load kernel section `sec` of row `row` of macro `macro` from `vs1`.
+/// The macro is selected through the otherwise unused vd field.
+#define dimc_ld_k(macro, vs1, row, sec)                   \
+    DIMC_EMIT(DIMC_INSN_I(DIMC_FUNCT3_LD_K, macro, vs1, \
+                          DIMC_IMM(0, row, sec)))
+
+/// Burst-load `n` (1..32) consecutive kernel sections of macro `macro`,
+/// starting at section `sec` of row `row`. Section i is read from VRF word i of
+/// the register group starting at `vs1` (two sections per register with a
+/// 256-bit datapath), and the target address wraps from section 3 into the
+/// next row. The instruction retires once the last section is written.
+#define dimc_ld_k_burst(macro, vs1, row, sec, n)           \
+    DIMC_EMIT(DIMC_INSN_I(DIMC_FUNCT3_LD_KB, macro, vs1, \
+                          DIMC_IMM((n)-1, row, sec)))
+
+/// Compute kernel row `row` against the feature buffer on every macro. The
+/// result of macro m is written to element (elem + m) of `vd`. `mode` is a
+/// DIMC_MODE_* resolution, optionally OR-ed with DIMC_SIGNED_* flags.
+#define dimc_dss(vd, vs1, row, mode, elem)                              \
+    DIMC_EMIT(DIMC_INSN_I(DIMC_FUNCT3_DSS, vd, vs1,                    \
+                          DIMC_IMM(((elem) << 2) | ((mode)&0x3), row, \
+                                   (mode) >> 2)))
+
+#define dimc_dps(vd, vs1, row, mode, elem)                              \
+    DIMC_EMIT(DIMC_INSN_I(DIMC_FUNCT3_DPS, vd, vs1,                    \
+                          DIMC_IMM(((elem) << 2) | ((mode)&0x3), row, \
+                                   (mode) >> 2)))
+
+//================================================================================
+// Matrix-vector
+//================================================================================
+
+// Results of one DMV, DIMC_NR_ROWS / DIMC_NR_MACROS rows on every macro
+#define DIMC_MV_RESULTS 32
+
+/// Compute output channels [row * DIMC_NR_MACROS, row * DIMC_NR_MACROS + 32)
+/// against the feature buffer with a single instruction. Channel row *
+/// DIMC_NR_MACROS + j is written to 32-bit element j of the register group
+/// starting at `vd`, which spans 1024 bits (LMUL = 1024 / VLEN), or packed into
+/// the first VRF word of `vd` with a narrow output stage.
+#define dimc_mv(vd, row, mode)                                     \
+    DIMC_EMIT(DIMC_INSN_I(DIMC_FUNCT3_DMV, vd, 0,                 \
+                          DIMC_IMM((mode)&0x3, row, (mode) >> 2)))
+
+/// Like dimc_mv, but adds the results to the partial sums held in `vd`.
+#define dimc_mv_acc(vd, row, mode)                                       \
+    DIMC_EMIT(DIMC_INSN_I(DIMC_FUNCT3_DMV, vd, 0,                       \
+                          DIMC_IMM((1 << 2) | ((mode)&0x3), row, (mode) >> 2)))
+
+// Accumulator modes of DMV, imm12[11:10]. The 32 accumulators (24 bits each)
+// sit next to the macros and hold one entry per DMV result, so reductions
+// longer than one row are chained without partial sums in the VRF.
+#define DIMC_ACC_ADD (1 << 3)    // accumulate, vd is not written
+#define DIMC_ACC_LAST (2 << 3)   // add the accumulators, write vd, clear them
+#define DIMC_ACC_DRAIN (3 << 3)  // write the accumulators to vd, clear them
+
+/// Add the products of one K tile to the accumulators.
+#define dimc_acc_mv(row, mode)                                      \
+    DIMC_EMIT(DIMC_INSN_I(DIMC_FUNCT3_DMV, 0, 0,                   \
+                          DIMC_IMM(DIMC_ACC_ADD | ((mode)&0x3), row, \
+                                   (mode) >> 2)))
+
+/// Compute the last K tile on top of the accumulators and write the results
+/// to `vd` through the output stage. The accumulators are cleared.
+#define dimc_acc_mv_last(vd, row, mode)                              \
+    DIMC_EMIT(DIMC_INSN_I(DIMC_FUNCT3_DMV, vd, 0,                   \
+                          DIMC_IMM(DIMC_ACC_LAST | ((mode)&0x3), row, \
+                                   (mode) >> 2)))
+
+/// Write the accumulators of rows starting at `row` to `vd` through the output
+/// stage and clear them.
+#define dimc_acc_drain(vd, row) \
+    DIMC_EMIT(DIMC_INSN_I(DIMC_FUNCT3_DMV, vd, 0, DIMC_IMM(DIMC_ACC_DRAIN, row, 0)))
+
+/// y[0:32] = W[row * DIMC_NR_MACROS:+32] * feature, with raw 32-bit outputs.
+/// Uses the v8-v11 register group (VLEN >= 256).
+#define dimc_matvec(y, row, mode)                                      \
+    do {                                                               \
+        uint32_t _vl;                                                  \
+        dimc_mv(8, row, mode);                                         \
+        asm volatile("vsetvli %0, %1, e32, m4, ta, ma"                 \
+                     : "=r"(_vl)                                       \
+                     : "r"(DIMC_MV_RESULTS));                          \
+        asm volatile("vse32.v v8, (%0)" ::"r"(y) : "memory");          \
+    } while (0)
+
+//================================================================================
+// Output stage
+//================================================================================
+
+// Activation, imm12[8:7] of LD_Q
+#define DIMC_ACT_NONE 0
+#define DIMC_ACT_RELU 1
+#define DIMC_ACT_RELU6 2
+
+// Output width, imm12[10:9] of LD_Q. DIMC_OUT_RAW returns the 24-bit partial
+// sums; the narrow widths requantize every result and, for DMV, pack the 32
+// outputs densely into the first VRF word of vd.
+#define DIMC_OUT_RAW 0
+#define DIMC_OUT_8B 1
+#define DIMC_OUT_4B 2
+#define DIMC_OUT_2B 3
+
+/// Requant table entry of one kernel row: y = (psum * mult + round) >> shift,
+/// then clamped. `clip` is the ReLU6 upper bound in output units.
+static inline uint32_t dimc_requant_entry(uint16_t mult, uint32_t shift,
+                                          uint8_t clip) {
+    return ((uint32_t)clip << 24) | ((shift & 0x1f) << 16) | mult;
+}
+
+/// Load the requant entries of rows [8 * group, 8 * group + 8) of macro
+/// `macro` from the first eight 32-bit elements of `vs1`, and select the
+/// activation and output width of all macros.
+#define dimc_ld_q(macro, vs1, group, act, out)             \
+    DIMC_EMIT(DIMC_INSN_I(DIMC_FUNCT3_LD_Q, macro, vs1,   \
+                          DIMC_IMM(((out) << 2) | (act), (group) << 3, 0)))
+
+/// Only select the activation and output width, keeping the requant tables.
+#define dimc_set_output(act, out)                                     \
+    DIMC_EMIT(DIMC_INSN_I(DIMC_FUNCT3_LD_Q, 0, 0,                    \
+                          DIMC_IMM((1 << 4) | ((out) << 2) | (act), 0, 0)))
+
+//================================================================================
+// Configuration registers
+//================================================================================
+
+// Register selected by imm12[11:8] of CFG, written from the scalar rs1
+#define DIMC_CFG_MCT 0
+
+/// Set the tail mask of the following DSS/DPS computes: the last `4 * mct`
+/// bits of every kernel row and of the feature buffer are left out of the dot
+/// product. The value stays in effect until the next dimc_set_mct.
+static inline void dimc_set_mct(uint32_t mct) {
+    register uint32_t reg_mct asm("a0") = mct;  // 10
+    asm volatile(".word %1" ::"r"(reg_mct),
+                 "i"(DIMC_INSN_I(DIMC_FUNCT3_CFG, 0, 10,
+                                 DIMC_IMM(DIMC_CFG_MCT << 1, 0, 0))));
+}
+
+/// Set the tail mask for a reduction of length `k` at resolution `mode`. The
+/// masking granularity is 4 bits, so the 1-bit and 2-bit modes round `k` up to
+/// a multiple of 4 and 2 elements respectively; the padding must be zero.
+static inline void dimc_set_k(uint32_t k, uint32_t mode) {
+    uint32_t bits = k << (mode & 0x3);
+    uint32_t row_bits = DIMC_NR_SECTIONS * 256;
+    if (bits > row_bits) bits = row_bits;
+    dimc_set_mct((row_bits - ((bits + 3) & ~3u)) / 4);
+}
+
+//================================================================================
+// Output channel placement
+//================================================================================
+
+// Output channels are interleaved across the macros: channel `ch` lives in
+// macro `ch % DIMC_NR_MACROS`, row `ch / DIMC_NR_MACROS`. A single DSS/DPS on
+// row r therefore returns channels [r * DIMC_NR_MACROS, (r + 1) *
+// DIMC_NR_MACROS) in consecutive elements of the destination register.
+
+/// Number of output channels resident in the DIMC array at once.
+#define DIMC_NR_CHANNELS (DIMC_NR_ROWS * DIMC_NR_MACROS)
+
+#define dimc_channel_macro(ch) ((ch) % DIMC_NR_MACROS)
+#define dimc_channel_row(ch) ((ch) / DIMC_NR_MACROS)
+
+/// Load kernel section `sec` of output channel `ch` from `vs1`.
+#define dimc_ld_k_channel(ch, vs1, sec) \
+    dimc_ld_k(dimc_channel_macro(ch), vs1, dimc_channel_row(ch), sec)
+
+/// Compute output channels [ch, ch + DIMC_NR_MACROS) into `vd`, starting at
+/// element `elem`. `ch` must be a multiple of DIMC_NR_MACROS.
+#define dimc_dss_channels(vd, vs1, ch, mode, elem) \
+    dimc_dss(vd, vs1, dimc_channel_row(ch), mode, elem)
+
+/// Number of DSS/DPS issues needed to compute `n` output channels.
+static inline uint32_t dimc_nr_computes(uint32_t n) {
+    return (n + DIMC_NR_MACROS - 1) / DIMC_NR_MACROS;
+}
@@ -0,0 +1,107 @@
+// Copyright 2020 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+#include <stdint.h>
+
+#include "dimc.h"
+
+// int8 GEMM front-end: C[M][N] (int32) = A[M][K] (int8) * B[K][N] (int8),
+// row-major. Every call is dispatched to the DIMC macros, to the vector
+// matmul_{2,4,8}xVL kernels, or split column-wise between both, whichever the
+// cost model predicts to be fastest for the shape.
+
+// Output channels per DMV, and elements of one kernel row at 8 bits
+#define INT8_GEMM_DIMC_TILE_N DIMC_MV_RESULTS
+#define INT8_GEMM_DIMC_TILE_K (DIMC_NR_SECTIONS * 256 / 8)
+// Partial sums run through the 24-bit DIMC accumulator, which holds any
+// K * 128 * 128 below 2^23
+#define INT8_GEMM_DIMC_MAX_K 511
+
+typedef enum {
+    INT8_GEMM_VECTOR,
+    INT8_GEMM_DIMC,
+    INT8_GEMM_SPLIT,
+} int8_gemm_backend_t;
+
+/// Per-op latencies of the cost model, in cycles.
+typedef struct {
+    // DIMC: weights of one output channel for one K tile (strided gather and
+    // LD_KB of four sections)
+    uint32_t dimc_ld_k;
+    // DIMC: one row of A for one K tile (four LD_F, one DMV, partial-sum load
+    // and store of 32 outputs)
+    uint32_t dimc_row;
+    // Vector: one K step of matmul_{2,4,8}xVL over one full vector of columns,
+    // indexed by log2(kernel size) - 1. Narrower column ranges scale linearly.
+    uint32_t vec_step[3];
+    // Vector length in bits
+    uint32_t vlen;
+} int8_gemm_cost_t;
+
+/// Backend selected for one call. With INT8_GEMM_SPLIT, columns [0, n_dimc)
+/// run on the DIMC and the rest on the vector kernel.
+typedef struct {
+    int8_gemm_backend_t backend;
+    uint32_t n_dimc;
+    uint32_t kernel_size;
+    uint32_t cycles;  // predicted
+} int8_gemm_plan_t;
+
+/// Scratch memory needed by int8_gemm_calibrate, in bytes.
+#define INT8_GEMM_CALIB_SCRATCH (8 * 1024)
+
+/// Fill `cost` with static estimates for the default cluster.
+void int8_gemm_cost_init(int8_gemm_cost_t *cost);
+
+/// Measure the per-op latencies on this core. `scratch` must hold
+/// INT8_GEMM_CALIB_SCRATCH bytes of TCDM. Overwrites the DIMC kernel memory
+/// and the tail mask.
+void int8_gemm_calibrate(int8_gemm_cost_t *cost, void *scratch);
+
+/// Predicted cycles of each backend for the whole problem; UINT32_MAX if the
+/// backend cannot run the shape. The vector backend runs any M: rows past the
+/// last whole block of the kernel size go through a one-row kernel.
+uint32_t int8_gemm_cost_dimc(const int8_gemm_cost_t *cost, uint32_t M,
+                             uint32_t N, uint32_t K);
+uint32_t int8_gemm_cost_vector(const int8_gemm_cost_t *cost, uint32_t M,
+                               uint32_t N, uint32_t K, uint32_t *kernel_size);
+
+/// Pick the fastest backend for a shape.
+int8_gemm_plan_t int8_gemm_plan(const int8_gemm_cost_t *cost, uint32_t M,
+                                uint32_t N, uint32_t K);
+
+/// Run a planned GEMM.
+void int8_gemm_run(int32_t *c, const int8_t *a, const int8_t *b, uint32_t M,
+                   uint32_t N, uint32_t K, const int8_gemm_plan_t *plan);
+
+/// Plan and run a GEMM.
+static inline int8_gemm_plan_t int8_gemm(int32_t *c, const int8_t *a,
+                                         const int8_t *b, uint32_t M,
+                                         uint32_t N, uint32_t K,
+                                         const int8_gemm_cost_t *cost) {
+    int8_gemm_plan_t plan = int8_gemm_plan(cost, M, N, K);
+    int8_gemm_run(c, a, b, M, N, K, &plan);
+    return plan;
+}
+
+/// Columns [n_start, n_end) of C on the DIMC, weight-stationary: every
+/// 32-column by 128-deep tile of B is loaded once and reused for all rows.
+void int8_gemm_dimc(int32_t *c, const int8_t *a, const int8_t *b, uint32_t M,
+                    uint32_t N, uint32_t K, uint32_t n_start, uint32_t n_end);
+
+// Vector kernels over rows [m_start, m_end) and columns [p_start, p_end) of
+// C[M][P] = A[M][N] * B[N][P]. The row count must be a multiple of the
+// kernel size.
+void matmul_2xVL(int32_t *c, const int8_t *a, const int8_t *b,
+                 const unsigned int m_start, const unsigned int m_end,
+                 const unsigned int N, const unsigned int P,
+                 const unsigned int p_start, const unsigned int p_end);
+void matmul_4xVL(int32_t *c, const int8_t *a, const int8_t *b,
+                 const unsigned int m_start, const unsigned int m_end,
+                 const unsigned int N, const unsigned int P,
+                 const unsigned int p_start, const unsigned int p_end);
+void matmul_8xVL(int32_t *c, const int8_t *a, const int8_t *b,
+                 const unsigned int m_start, const unsigned int m_end,
+                 const unsigned int N, const unsigned int P,
+                 const unsigned int p_start, const unsigned int p_end);
@@ -0,0 +1,526 @@
+// Copyright 2020 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "int8_gemm.h"
+
+#include <snrt.h>
+#include <stddef.h>
+
+#include "encoding.h"
+
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+
+// Signed 8-bit operands on both sides
+#define INT8_GEMM_MODE (DIMC_MODE_8B | DIMC_SIGNED)
+
+//================================================================================
+// DIMC backend
+//================================================================================
+
+// Gather output channel `ch` of the tile (one column of B, `k_len` deep) into
+// v16 and write it to its kernel row.
+#define INT8_GEMM_LD_K(ch)                                                \
+    if ((ch) < n_len) {                                                   \
+        asm volatile("vlse8.v v16, (%0), %1" ::"r"(w + (ch)), "r"(ldw));  \
+        dimc_ld_k_burst(dimc_channel_macro(ch), 16, dimc_channel_row(ch), \
+                        0, DIMC_NR_SECTIONS);                             \
+    }
+
+// Load the weights of a 32-column by `k_len`-deep tile starting at `w`. The
+// kernel row and macro are immediates, so the channels are unrolled.
+static inline void int8_gemm_ld_k(const int8_t *w, uint32_t ldw,
+                                  uint32_t k_len, uint32_t n_len) {
+    size_t vl;
+    asm volatile("vsetvli %0, %1, e8, m4, ta, ma" : "=r"(vl) : "r"(k_len));
+    INT8_GEMM_LD_K(0) INT8_GEMM_LD_K(1) INT8_GEMM_LD_K(2) INT8_GEMM_LD_K(3)
+    INT8_GEMM_LD_K(4) INT8_GEMM_LD_K(5) INT8_GEMM_LD_K(6) INT8_GEMM_LD_K(7)
+    INT8_GEMM_LD_K(8) INT8_GEMM_LD_K(9) INT8_GEMM_LD_K(10) INT8_GEMM_LD_K(11)
+    INT8_GEMM_LD_K(12) INT8_GEMM_LD_K(13) INT8_GEMM_LD_K(14) INT8_GEMM_LD_K(15)
+    INT8_GEMM_LD_K(16) INT8_GEMM_LD_K(17) INT8_GEMM_LD_K(18) INT8_GEMM_LD_K(19)
+    INT8_GEMM_LD_K(20) INT8_GEMM_LD_K(21) INT8_GEMM_LD_K(22) INT8_GEMM_LD_K(23)
+    INT8_GEMM_LD_K(24) INT8_GEMM_LD_K(25) INT8_GEMM_LD_K(26) INT8_GEMM_LD_K(27)
+    INT8_GEMM_LD_K(28) INT8_GEMM_LD_K(29) INT8_GEMM_LD_K(30) INT8_GEMM_LD_K(31)
+}
+
+// Load `k_len` elements of one row of A into the feature buffer, one section
+// per register. Sections past `k_len` are left stale; the tail mask hides them.
+static inline void int8_gemm_ld_f(const int8_t *x, uint32_t k_len) {
+    size_t vl;
+    asm volatile("vsetvli %0, %1, e8, m1, ta, ma" : "=r"(vl) : "r"(k_len));
+    asm volatile("vle8.v v4, (%0)" ::"r"(x));
+    dimc_ld_f(4, 0);
+    if (k_len > 32) {
+        asm volatile("vsetvli %0, %1, e8, m1, ta, ma" : "=r"(vl) : "r"(k_len - 32));
+        asm volatile("vle8.v v5, (%0)" ::"r"(x + 32));
+        dimc_ld_f(5, 1);
+    }
+    if (k_len > 64) {
+        asm volatile("vsetvli %0, %1, e8, m1, ta, ma" : "=r"(vl) : "r"(k_len - 64));
+        asm volatile("vle8.v v6, (%0)" ::"r"(x + 64));
+        dimc_ld_f(6, 2);
+    }
+    if (k_len > 96) {
+        asm volatile("vsetvli %0, %1, e8, m1, ta, ma" : "=r"(vl) : "r"(k_len - 96));
+        asm volatile("vle8.v v7, (%0)" ::"r"(x + 96));
+        dimc_ld_f(7, 3);
+    }
+}
+
+// One row of A against the resident tile: outputs [0, n_len) of `c`. The
+// first K tile starts from zero, the following ones add to the partial sums.
+static inline void int8_gemm_dimc_row(int32_t *c, const int8_t *x,
+                                      uint32_t k_len, uint32_t n_len,
+                                      uint32_t first) {
+    size_t vl;
+    int8_gemm_ld_f(x, k_len);
+    asm volatile("vsetvli %0, %1, e32, m4, ta, ma" : "=r"(vl) : "r"(n_len));
+    if (first) {
+        dimc_mv(8, 0, INT8_GEMM_MODE);
+    } else {
+        asm volatile("vle32.v v8, (%0)" ::"r"(c));
+        dimc_mv_acc(8, 0, INT8_GEMM_MODE);
+    }
+    asm volatile("vse32.v v8, (%0)" ::"r"(c) : "memory");
+}
+
+void int8_gemm_dimc(int32_t *c, const int8_t *a, const int8_t *b, uint32_t M,
+                    uint32_t N, uint32_t K, uint32_t n_start, uint32_t n_end) {
+    dimc_set_output(DIMC_ACT_NONE, DIMC_OUT_RAW);
+
+    for (uint32_t n0 = n_start; n0 < n_end; n0 += INT8_GEMM_DIMC_TILE_N) {
+        uint32_t n_len = MIN(INT8_GEMM_DIMC_TILE_N, n_end - n0);
+
+        for (uint32_t k0 = 0; k0 < K; k0 += INT8_GEMM_DIMC_TILE_K) {
+            uint32_t k_len = MIN(INT8_GEMM_DIMC_TILE_K, K - k0);
+
+            int8_gemm_ld_k(b + k0 * N + n0, N, k_len, n_len);
+            if (k_len < INT8_GEMM_DIMC_TILE_K) dimc_set_k(k_len, DIMC_MODE_8B);
+
+            for (uint32_t m = 0; m < M; ++m)
+                int8_gemm_dimc_row(c + m * N + n0, a + m * K + k0, k_len, n_len,
+                                   k0 == 0);
+
+            if (k_len < INT8_GEMM_DIMC_TILE_K) dimc_set_mct(0);
+        }
+    }
+}
+
+//================================================================================
+// Vector backend
+//================================================================================
+
+// B is sign-extended to 32 bits with two widening adds per K step, and the
+// rows of A are multiplied in with vmacc.vx.
+
+// ---------------
+// 2xVL
+// ---------------
+
+void matmul_2xVL(int32_t *c, const int8_t *a, const int8_t *b,
+                 const unsigned int m_start, const unsigned int m_end,
+                 const unsigned int N, const unsigned int P,
+                 const unsigned int p_start, const unsigned int p_end) {
+
+    unsigned int p = p_start;
+    while (p < p_end) {
+        // Calculate the vl
+        size_t gvl;
+        asm volatile("vsetvli %[gvl], %[vl], e32, m8, ta, ma"
+                     : [gvl] "=r"(gvl)
+                     : [vl] "r"(p_end - p));
+
+        const int8_t *b_ = b + p;
+        int32_t *c_ = c + p;
+
+        for (unsigned int m = m_start; m < m_end; m += 2) {
+            const int8_t *a_ = a + m * N;
+            const int8_t *b__ = b_;
+            int32_t *c__ = c_ + m * P;
+
+            asm volatile("vmv.v.x v0, zero");
+            asm volatile("vmv.v.x v8, zero");
+
+            for (unsigned int n = 0; n < N; ++n) {
+                int32_t t0 = a_[n];
+                int32_t t1 = a_[N + n];
+
+                asm volatile("vsetvli zero, %0, e8, m2, ta, ma" ::"r"(gvl));
+                asm volatile("vle8.v v24, (%0);" ::"r"(b__));
+                b__ += P;
+                asm volatile("vwadd.vx v28, v24, zero");
+                asm volatile("vsetvli zero, %0, e16, m4, ta, ma" ::"r"(gvl));
+                asm volatile("vwadd.vx v16, v28, zero");
+                asm volatile("vsetvli zero, %0, e32, m8, ta, ma" ::"r"(gvl));
+
+                asm volatile("vmacc.vx v0, %0, v16" ::"r"(t0));
+                asm volatile("vmacc.vx v8, %0, v16" ::"r"(t1));
+            }
+
+            asm volatile("vse32.v v0, (%0);" ::"r"(c__));
+            c__ += P;
+            asm volatile("vse32.v v8, (%0);" ::"r"(c__));
+        }
+
+        p += gvl;
+    }
+}
+
+// ---------------
+// 4xVL
+// ---------------
+
+void matmul_4xVL(int32_t *c, const int8_t *a, const int8_t *b,
+                 const unsigned int m_start, const unsigned int m_end,
+                 const unsigned int N, const unsigned int P,
+                 const unsigned int p_start, const unsigned int p_end) {
+
+    unsigned int p = p_start;
+    while (p < p_end) {
+        // Calculate the vl
+        size_t gvl;
+        asm volatile("vsetvli %[gvl], %[vl], e32, m4, ta, ma"
+                     : [gvl] "=r"(gvl)
+                     : [vl] "r"(p_end - p));
+
+        const int8_t *b_ = b + p;
+        int32_t *c_ = c + p;
+
+        for (unsigned int m = m_start; m < m_end; m += 4) {
+            const int8_t *a_ = a + m * N;
+            const int8_t *b__ = b_;
+            int32_t *c__ = c_ + m * P;
+
+            asm volatile("vmv.v.x v0, zero");
+            asm volatile("vmv.v.x v4, zero");
+            asm volatile("vmv.v.x v8, zero");
+            asm volatile("vmv.v.x v12, zero");
+
+            for (unsigned int n = 0; n < N; ++n) {
+                int32_t t0 = a_[n];
+                int32_t t1 = a_[N + n];
+                int32_t t2 = a_[2 * N + n];
+                int32_t t3 = a_[3 * N + n];
+
+                asm volatile("vsetvli zero, %0, e8, m1, ta, ma" ::"r"(gvl));
+                asm volatile("vle8.v v20, (%0);" ::"r"(b__));
+                b__ += P;
+                asm volatile("vwadd.vx v24, v20, zero");
+                asm volatile("vsetvli zero, %0, e16, m2, ta, ma" ::"r"(gvl));
+                asm volatile("vwadd.vx v16, v24, zero");
+                asm volatile("vsetvli zero, %0, e32, m4, ta, ma" ::"r"(gvl));
+
+                asm volatile("vmacc.vx v0, %0, v16" ::"r"(t0));
+                asm volatile("vmacc.vx v4, %0, v16" ::"r"(t1));
+                asm volatile("vmacc.vx v8, %0, v16" ::"r"(t2));
+                asm volatile("vmacc.vx v12, %0, v16" ::"r"(t3));
+            }
+
+            asm volatile("vse32.v v0, (%0);" ::"r"(c__));
+            c__ += P;
+            asm volatile("vse32.v v4, (%0);" ::"r"(c__));
+            c__ += P;
+            asm volatile("vse32.v v8, (%0);" ::"r"(c__));
+            c__ += P;
+            asm volatile("vse32.v v12, (%0);" ::"r"(c__));
+        }
+
+        p += gvl;
+    }
+}
+
+// ---------------
+// 8xVL
+// ---------------
+
+void matmul_8xVL(int32_t *c, const int8_t *a, const int8_t *b,
+                 const unsigned int m_start, const unsigned int m_end,
+                 const unsigned int N, const unsigned int P,
+                 const unsigned int p_start, const unsigned int p_end) {
+
+    unsigned int p = p_start;
+    while (p < p_end) {
+        // Calculate the vl
+        size_t gvl;
+        asm volatile("vsetvli %[gvl], %[vl], e32, m2, ta, ma"
+                     : [gvl] "=r"(gvl)
+                     : [vl] "r"(p_end - p));
+
+        const int8_t *b_ = b + p;
+        int32_t *c_ = c + p;
+
+        for (unsigned int m = m_start; m < m_end; m += 8) {
+            const int8_t *a_ = a + m * N;
+            const int8_t *b__ = b_;
+            int32_t *c__ = c_ + m * P;
+
+            asm volatile("vmv.v.x v0, zero");
+            asm volatile("vmv.v.x v2, zero");
+            asm volatile("vmv.v.x v4, zero");
+            asm volatile("vmv.v.x v6, zero");
+            asm volatile("vmv.v.x v8, zero");
+            asm volatile("vmv.v.x v10, zero");
+            asm volatile("vmv.v.x v12, zero");
+            asm volatile("vmv.v.x v14, zero");
+
+            for (unsigned int n = 0; n < N; ++n) {
+                const int8_t *a__ = a_ + n;
+
+                asm volatile("vsetvli zero, %0, e8, mf2, ta, ma" ::"r"(gvl));
+                asm volatile("vle8.v v18, (%0);" ::"r"(b__));
+                b__ += P;
+                asm volatile("vwadd.vx v20, v18, zero");
+                asm volatile("vsetvli zero, %0, e16, m1, ta, ma" ::"r"(gvl));
+                asm volatile("vwadd.vx v16, v20, zero");
+                asm volatile("vsetvli zero, %0, e32, m2, ta, ma" ::"r"(gvl));
+
+                asm volatile("vmacc.vx v0, %0, v16" ::"r"((int32_t)a__[0]));
+                asm volatile("vmacc.vx v2, %0, v16" ::"r"((int32_t)a__[N]));
+                asm volatile("vmacc.vx v4, %0, v16" ::"r"((int32_t)a__[2 * N]));
+                asm volatile("vmacc.vx v6, %0, v16" ::"r"((int32_t)a__[3 * N]));
+                asm volatile("vmacc.vx v8, %0, v16" ::"r"((int32_t)a__[4 * N]));
+                asm volatile("vmacc.vx v10, %0, v16" ::"r"((int32_t)a__[5 * N]));
+                asm volatile("vmacc.vx v12, %0, v16" ::"r"((int32_t)a__[6 * N]));
+                asm volatile("vmacc.vx v14, %0, v16" ::"r"((int32_t)a__[7 * N]));
+            }
+
+            asm volatile("vse32.v v0, (%0);" ::"r"(c__));
+            c__ += P;
+            asm volatile("vse32.v v2, (%0);" ::"r"(c__));
+            c__ += P;
+            asm volatile("vse32.v v4, (%0);" ::"r"(c__));
+            c__ += P;
+            asm volatile("vse32.v v6, (%0);" ::"r"(c__));
+            c__ += P;
+            asm volatile("vse32.v v8, (%0);" ::"r"(c__));
+            c__ += P;
+            asm volatile("vse32.v v10, (%0);" ::"r"(c__));
+            c__ += P;
+            asm volatile("vse32.v v12, (%0);" ::"r"(c__));
+            c__ += P;
+            asm volatile("vse32.v v14, (%0);" ::"r"(c__));
+        }
+
+        p += gvl;
+    }
+}
+
+// ---------------
+// 1xVL
+// ---------------
+
+// Rows left over when M is not a multiple of the kernel size
+static void matmul_1xVL(int32_t *c, const int8_t *a, const int8_t *b,
+                        const unsigned int m_start, const unsigned int m_end,
+                        const unsigned int N, const unsigned int P,
+                        const unsigned int p_start, const unsigned int p_end) {
+
+    unsigned int p = p_start;
+    while (p < p_end) {
+        // Calculate the vl
+        size_t gvl;
+        asm volatile("vsetvli %[gvl], %[vl], e32, m8, ta, ma"
+                     : [gvl] "=r"(gvl)
+                     : [vl] "r"(p_end - p));
+
+        const int8_t *b_ = b + p;
+        int32_t *c_ = c + p;
+
+        for (unsigned int m = m_start; m < m_end; ++m) {
+            const int8_t *a_ = a + m * N;
+            const int8_t *b__ = b_;
+
+            asm volatile("vmv.v.x v0, zero");
+
+            for (unsigned int n = 0; n < N; ++n) {
+                int32_t t0 = a_[n];
+
+                asm volatile("vsetvli zero, %0, e8, m2, ta, ma" ::"r"(gvl));
+                asm volatile("vle8.v v24, (%0);" ::"r"(b__));
+                b__ += P;
+                asm volatile("vwadd.vx v28, v24, zero");
+                asm volatile("vsetvli zero, %0, e16, m4, ta, ma" ::"r"(gvl));
+                asm volatile("vwadd.vx v16, v28, zero");
+                asm volatile("vsetvli zero, %0, e32, m8, ta, ma" ::"r"(gvl));
+
+                asm volatile("vmacc.vx v0, %0, v16" ::"r"(t0));
+            }
+
+            asm volatile("vse32.v v0, (%0);" ::"r"(c_ + m * P));
+        }
+
+        p += gvl;
+    }
+}
+
+// Whole blocks of `kernel_size` rows, then the remaining rows one by one
+static void int8_gemm_vector(int32_t *c, const int8_t *a, const int8_t *b,
+                             uint32_t M, uint32_t N, uint32_t K,
+                             uint32_t kernel_size, uint32_t n_start) {
+    uint32_t m_end = M - M % kernel_size;
+
+    if (kernel_size == 8)
+        matmul_8xVL(c, a, b, 0, m_end, K, N, n_start, N);
+    else if (kernel_size == 4)
+        matmul_4xVL(c, a, b, 0, m_end, K, N, n_start, N);
+    else
+        matmul_2xVL(c, a, b, 0, m_end, K, N, n_start, N);
+
+    if (m_end < M) matmul_1xVL(c, a, b, m_end, M, K, N, n_start, N);
+}
+
+//================================================================================
+// Cost model
+//================================================================================
+
+static inline uint32_t int8_gemm_log2_size(uint32_t kernel_size) {
+    return kernel_size == 8 ? 2 : kernel_size == 4 ? 1 : 0;
+}
+
+// Columns covered by one vector of the kernel: e32 with LMUL = 16 / size
+static inline uint32_t int8_gemm_vlmax(const int8_gemm_cost_t *cost,
+                                       uint32_t kernel_size) {
+    return cost->vlen / 32 * (16 / kernel_size);
+}
+
+void int8_gemm_cost_init(int8_gemm_cost_t *cost) {
+    uint32_t vlenb;
+    asm volatile("csrr %0, vlenb" : "=r"(vlenb));
+
+    // Estimates for four 32-bit IPUs; int8_gemm_calibrate measures them
+    cost->dimc_ld_k = 48;
+    cost->dimc_row = 96;
+    cost->vec_step[0] = 104;
+    cost->vec_step[1] = 90;
+    cost->vec_step[2] = 84;
+    cost->vlen = vlenb * 8;
+}
+
+uint32_t int8_gemm_cost_dimc(const int8_gemm_cost_t *cost, uint32_t M,
+                             uint32_t N, uint32_t K) {
+    if (K == 0 || K > INT8_GEMM_DIMC_MAX_K) return UINT32_MAX;
+
+    uint32_t tiles_n = (N + INT8_GEMM_DIMC_TILE_N - 1) / INT8_GEMM_DIMC_TILE_N;
+    uint32_t tiles_k = (K + INT8_GEMM_DIMC_TILE_K - 1) / INT8_GEMM_DIMC_TILE_K;
+    return tiles_n * tiles_k *
+           (INT8_GEMM_DIMC_TILE_N * cost->dimc_ld_k + M * cost->dimc_row);
+}
+
+uint32_t int8_gemm_cost_vector(const int8_gemm_cost_t *cost, uint32_t M,
+                               uint32_t N, uint32_t K, uint32_t *kernel_size) {
+    uint32_t best = UINT32_MAX;
+    // The 1xVL rows left over by any kernel are taken to cost a 2xVL step
+    uint32_t vlmax_1 = int8_gemm_vlmax(cost, 2);
+    uint32_t step_1 = cost->vec_step[0];
+    uint32_t row_1 = K * ((N * step_1 + vlmax_1 - 1) / vlmax_1);
+    for (uint32_t size = 2; size <= 8; size *= 2) {
+        // A partial vector is assumed to take proportionally fewer cycles
+        uint32_t vlmax = int8_gemm_vlmax(cost, size);
+        uint32_t step = cost->vec_step[int8_gemm_log2_size(size)];
+        uint32_t cycles = (M / size) * K * ((N * step + vlmax - 1) / vlmax) +
+                          (M % size) * row_1;
+        if (cycles < best) {
+            best = cycles;
+            if (kernel_size) *kernel_size = size;
+        }
+    }
+    return best;
+}
+
+int8_gemm_plan_t int8_gemm_plan(const int8_gemm_cost_t *cost, uint32_t M,
+                                uint32_t N, uint32_t K) {
+    int8_gemm_plan_t plan = {.backend = INT8_GEMM_VECTOR, .kernel_size = 2};
+
+    plan.cycles = int8_gemm_cost_vector(cost, M, N, K, &plan.kernel_size);
+
+    uint32_t dimc = int8_gemm_cost_dimc(cost, M, N, K);
+    if (dimc < plan.cycles) {
+        plan.backend = INT8_GEMM_DIMC;
+        plan.n_dimc = N;
+        plan.cycles = dimc;
+    }
+
+    // Full DIMC tiles first, the remaining columns on the vector kernel
+    for (uint32_t n_dimc = INT8_GEMM_DIMC_TILE_N; n_dimc < N;
+         n_dimc += INT8_GEMM_DIMC_TILE_N) {
+        uint32_t size;
+        uint32_t head = int8_gemm_cost_dimc(cost, M, n_dimc, K);
+        uint32_t tail = int8_gemm_cost_vector(cost, M, N - n_dimc, K, &size);
+        if (head == UINT32_MAX || tail == UINT32_MAX) break;
+        if (head + tail < plan.cycles) {
+            plan.backend = INT8_GEMM_SPLIT;
+            plan.n_dimc = n_dimc;
+            plan.kernel_size = size;
+            plan.cycles = head + tail;
+        }
+    }
+
+    return plan;
+}
+
+void int8_gemm_run(int32_t *c, const int8_t *a, const int8_t *b, uint32_t M,
+                   uint32_t N, uint32_t K, const int8_gemm_plan_t *plan) {
+    switch (plan->backend) {
+        case INT8_GEMM_DIMC:
+            int8_gemm_dimc(c, a, b, M, N, K, 0, N);
+            break;
+        case INT8_GEMM_SPLIT:
+            int8_gemm_dimc(c, a, b, M, N, K, 0, plan->n_dimc);
+            int8_gemm_vector(c, a, b, M, N, K, plan->kernel_size, plan->n_dimc);
+            break;
+        default:
+            int8_gemm_vector(c, a, b, M, N, K, plan->kernel_size, 0);
+            break;
+    }
+}
+
+//================================================================================
+// Calibration
+//================================================================================
+
+// Wait for the last vector store to land before reading the cycle counter
+static inline uint32_t int8_gemm_cycles(const volatile int32_t *last) {
+    (void)*last;
+    return read_csr(mcycle);
+}
+
+void int8_gemm_calibrate(int8_gemm_cost_t *cost, void *scratch) {
+    int8_gemm_cost_init(cost);
+
+    // 1 KiB of A, 4 KiB of B, 2 KiB of C
+    int8_t *a = (int8_t *)scratch;
+    int8_t *b = a + 1024;
+    int32_t *c = (int32_t *)(b + 4096);
+    for (uint32_t i = 0; i < 1024 + 4096; ++i) a[i] = (int8_t)(i * 37 + 11);
+
+    const uint32_t rows = 8;
+    const uint32_t K = INT8_GEMM_DIMC_TILE_K;
+    const uint32_t N = INT8_GEMM_DIMC_TILE_N;
+    uint32_t t0, t1;
+
+    // DIMC weight load of one full tile
+    dimc_set_output(DIMC_ACT_NONE, DIMC_OUT_RAW);
+    t0 = read_csr(mcycle);
+    int8_gemm_ld_k(b, N, K, N);
+    int8_gemm_dimc_row(c, a, K, N, 1);
+    t1 = int8_gemm_cycles(&c[N - 1]);
+    uint32_t ld_k_row = t1 - t0;
+
+    // DIMC rows on the resident tile, accumulating as in a deep K loop
+    t0 = read_csr(mcycle);
+    for (uint32_t m = 0; m < rows; ++m)
+        int8_gemm_dimc_row(c, a + m * K, K, N, 0);
+    t1 = int8_gemm_cycles(&c[N - 1]);
+    cost->dimc_row = (t1 - t0) / rows;
+    cost->dimc_ld_k =
+        ld_k_row > cost->dimc_row ? (ld_k_row - cost->dimc_row) / N : 0;
+
+    // One full vector of columns per kernel size, `rows` deep
+    for (uint32_t size = 2; size <= 8; size *= 2) {
+        uint32_t cols = int8_gemm_vlmax(cost, size);
+        t0 = read_csr(mcycle);
+        int8_gemm_vector(c, a, b, size, cols, rows, size, 0);
+        t1 = int8_gemm_cycles(&c[size * cols - 1]);
+        cost->vec_step[int8_gemm_log2_size(size)] = (t1 - t0) / rows;
+    }
+}
@@ -3,6 +3,8 @@
 #include <stdio.h>
 #include "printf.h"
 #include <snrt.h>
+#include "dimc.h"
+#include "perf_cnt.h"
 
 int Filter1[256] = {
     0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,
@@ -137,6 +139,22 @@ static inline void load_to_vrf_MatrixB(int *src) {
     asm volatile("vse32.v v31, (%0)" :: "r"(dst));
     }
 
+// DIMC events, profiled two at a time (one per perf counter)
+static const char *dimc_event_name[] = {
+    "compute", "ld_f", "ld_k", "stall_ready", "stall_fifo", "wb_conflict",
+};
+
+// Feature load, kernel burst and one matrix-vector product
+static inline void dimc_profile_kernel(int *feature, int *kernel, int *out) {
+    set_vector_length(16);
+    asm volatile("vle32.v v0, (%0)" :: "r"(feature));
+    asm volatile("vle32.v v2, (%0)" :: "r"(kernel));
+    asm volatile("vle32.v v3, (%0)" :: "r"(kernel + 16));
+    dimc_ld_f(0, 0);
+    dimc_ld_k_burst(0, 2, 0, 0, 4);
+    dimc_matvec(out, 0, DIMC_MODE_4B);
+}
+
 int main() {
 
     const unsigned int cid = snrt_cluster_core_idx();
@@ -188,6 +206,19 @@ int main() {
         printf("The execution took %u cycles.\n", timer_temp);
         printf("Start time : %u cycles\n", timer_start);
         printf("End time   : %u cycles\n", timer_end);
+
+        // DIMC event profile
+        for (int e = SNRT_PERF_CNT_DIMC_COMPUTE; e <= SNRT_PERF_CNT_DIMC_WB_CONFLICT; e += 2) {
+            snrt_reset_perf_counter(SNRT_PERF_CNT0);
+            snrt_reset_perf_counter(SNRT_PERF_CNT1);
+            snrt_start_perf_counter_dimc(SNRT_PERF_CNT0, e, cid);
+            snrt_start_perf_counter_dimc(SNRT_PERF_CNT1, e + 1, cid);
+            dimc_profile_kernel(a, b, c);
+            snrt_stop_perf_counter(SNRT_PERF_CNT0);
+            snrt_stop_perf_counter(SNRT_PERF_CNT1);
+            printf("DIMC %-12s: %u\n", dimc_event_name[e], snrt_get_perf_counter(SNRT_PERF_CNT0));
+            printf("DIMC %-12s: %u\n", dimc_event_name[e + 1], snrt_get_perf_counter(SNRT_PERF_CNT1));
+        }
         /*
         for (int tb = 0; tb < 2; tb++) {
 
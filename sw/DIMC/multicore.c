@@ -0,0 +1,108 @@
+// Copyright 2020 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "benchmark.c"
+#include <snrt.h>
+#include "printf.h"
+#include "int8_gemm.h"
+
+// Every compute core owns a Spatz with its own DIMC macros, so the cluster
+// scales by splitting the rows of C across the cores: each core loads the
+// same weight tiles into its own kernel memory and streams its share of the
+// rows of A through them.
+
+#define M 64
+#define N 64
+#define K 256
+
+static int8_t *a;
+static int8_t *b;
+static int32_t *c;
+
+static uint32_t lcg_state = 42;
+
+static inline int8_t lcg_next() {
+    lcg_state = lcg_state * 1664525u + 1013904223u;
+    return (int8_t)(lcg_state >> 24);
+}
+
+// Rows [m_start, m_end) of C on this core's DIMC
+static inline void gemm_rows(uint32_t m_start, uint32_t m_end) {
+    if (m_start < m_end)
+        int8_gemm_dimc(c + m_start * N, a + m_start * K, b, m_end - m_start, N,
+                       K, 0, N);
+}
+
+static int verify() {
+    int errors = 0;
+    for (uint32_t m = 0; m < M; ++m)
+        for (uint32_t n = 0; n < N; ++n) {
+            int32_t golden = 0;
+            for (uint32_t k = 0; k < K; ++k)
+                golden += (int32_t)a[m * K + k] * (int32_t)b[k * N + n];
+            if (c[m * N + n] != golden) ++errors;
+        }
+    return errors;
+}
+
+int main() {
+    const unsigned int cid = snrt_cluster_core_idx();
+    int errors = 0;
+    // A single-core cluster has no separate compute core
+    unsigned int nr_cores = snrt_cluster_compute_core_num();
+    if (nr_cores == 0) nr_cores = 1;
+
+    if (cid == 0) {
+        a = (int8_t *)snrt_l1alloc(M * K);
+        b = (int8_t *)snrt_l1alloc(K * N);
+        c = (int32_t *)snrt_l1alloc(M * N * sizeof(int32_t));
+        for (uint32_t i = 0; i < M * K; ++i) a[i] = lcg_next();
+        for (uint32_t i = 0; i < K * N; ++i) b[i] = lcg_next();
+    }
+
+    size_t timer_start, timer_end, timer_single;
+
+    // One core
+    snrt_cluster_hw_barrier();
+    if (cid == 0) {
+        timer_start = benchmark_get_cycle();
+        start_kernel();
+        gemm_rows(0, M);
+        stop_kernel();
+        timer_single = benchmark_get_cycle() - timer_start;
+    }
+
+    // All compute cores, contiguous blocks of rows
+    snrt_cluster_hw_barrier();
+    if (cid == 0) {
+        for (uint32_t i = 0; i < M * N; ++i) c[i] = 0;
+        timer_start = benchmark_get_cycle();
+        start_kernel();
+    }
+    snrt_cluster_hw_barrier();
+    if (cid < nr_cores) {
+        uint32_t rows = (M + nr_cores - 1) / nr_cores;
+        uint32_t m_start = cid * rows;
+        uint32_t m_end = m_start + rows < M ? m_start + rows : M;
+        gemm_rows(m_start < M ? m_start : M, m_end);
+    }
+    snrt_cluster_hw_barrier();
+
+    if (cid == 0) {
+        stop_kernel();
+        timer_end = benchmark_get_cycle();
+        size_t timer_multi = timer_end - timer_start;
+
+        errors = verify();
+        printf("%ux%ux%u int8 GEMM on the DIMC\n", M, N, K);
+        printf("1 core   : %u cycles\n", timer_single);
+        printf("%u core(s): %u cycles, speedup %u.%02u\n", nr_cores,
+               timer_multi, timer_single / timer_multi,
+               (timer_single * 100 / timer_multi) % 100);
+        printf("%d errors\n", errors);
+    }
+
+    snrt_cluster_hw_barrier();
+    return errors;
+}
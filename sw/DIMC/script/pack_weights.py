@@ -0,0 +1,282 @@
+#!/usr/bin/env python3
+# Copyright 2023 ETH Zurich and University of Bologna.
+# Licensed under the Apache License, Version 2.0, see LICENSE for details.
+# SPDX-License-Identifier: Apache-2.0
+
+# Pack a weight tensor into DIMC kernel-memory images.
+#
+# The output is laid out exactly like the kernel memory window of one core
+# (`snrt_dimc_load_weights_async`): macro-major, then row, then section, with
+# 128 B per row. Each tile holds DIMC_NR_CHANNELS output channels by one
+# 1024-bit row of reduction elements and can be loaded with a single DMA
+# transfer or row by row with LD_K. Output channel `ch` of a tile lives in
+# macro `ch % n_dimc`, row `ch // n_dimc`, as in `dimc.h`.
+
+import numpy as np
+import argparse
+import pathlib
+
+NR_ROWS = 32
+NR_SECTIONS = 4
+SECTION_BITS = 256
+ROW_BITS = NR_SECTIONS * SECTION_BITS
+ROW_BYTES = ROW_BITS // 8
+
+# DIMC_MODE_* and DIMC_SIGNED of `dimc.h`
+MODES = {1: 0, 2: 1, 4: 2, 8: 3}
+SIGNED = 3 << 2
+
+# The DIMC accumulator and the ADDIN bias input are 24 bits wide
+ACC_MIN = -(1 << 23)
+ACC_MAX = (1 << 23) - 1
+
+
+def load_tensor(path: pathlib.Path, key=None):
+    """Load a weight tensor from a .npy/.npz file or an ONNX initializer."""
+    if path.suffix == ".npy":
+        return np.load(path)
+    if path.suffix == ".npz":
+        data = np.load(path)
+        if key is None:
+            if len(data.files) != 1:
+                raise SystemExit(f"{path}: select one of {data.files} with --key")
+            key = data.files[0]
+        return data[key]
+    if path.suffix == ".onnx":
+        import onnx
+        from onnx import numpy_helper
+
+        if key is None:
+            raise SystemExit(f"{path}: select an initializer with --key")
+        for init in onnx.load(str(path)).graph.initializer:
+            if init.name == key:
+                return numpy_helper.to_array(init)
+        raise SystemExit(f"{path}: no initializer named {key}")
+    raise SystemExit(f"{path}: unsupported format, use .npy, .npz or .onnx")
+
+
+def quantize(weights, prec, signed):
+    """Quantize float weights per output channel.
+
+    Returns the integer weights and the per-channel scales. Integer tensors are
+    checked against the target range and passed through with unit scales.
+    """
+    if prec == 1:
+        qmin, qmax = (-1, 1) if signed else (0, 1)
+    elif signed:
+        qmin, qmax = -(1 << (prec - 1)), (1 << (prec - 1)) - 1
+    else:
+        qmin, qmax = 0, (1 << prec) - 1
+
+    n = weights.shape[0]
+    if np.issubdtype(weights.dtype, np.integer):
+        if weights.min() < qmin or weights.max() > qmax:
+            raise SystemExit(f"weights exceed the {prec}-bit range [{qmin}, {qmax}]")
+        if prec == 1 and signed and np.any(weights == 0):
+            raise SystemExit("1-bit signed weights must be -1 or +1")
+        return weights.astype(np.int64), np.ones(n)
+
+    if prec == 1:
+        # Binarization: sign for the bipolar encoding, threshold at the mean
+        # otherwise. The scale is the mean magnitude of each channel.
+        scale = np.abs(weights).mean(axis=1)
+        if signed:
+            q = np.where(weights >= 0, 1, -1)
+        else:
+            q = (weights >= weights.mean(axis=1, keepdims=True)).astype(np.int64)
+    else:
+        if not signed and weights.min() < 0:
+            raise SystemExit("negative weights need a signed target")
+        scale = np.abs(weights).max(axis=1) / qmax
+        scale[scale == 0] = 1.0
+        q = np.clip(np.rint(weights / scale[:, None]), qmin, qmax)
+    return q.astype(np.int64), scale
+
+
+def pack_row(values, prec, signed):
+    """Pack up to ROW_BITS / prec elements into one kernel row, element `i` at
+    bits [i * prec, (i + 1) * prec). The unused tail is zero."""
+    lane_mask = (1 << prec) - 1
+    if prec == 1 and signed:
+        # Bipolar encoding: +1 is a set bit, -1 a clear one
+        values = (values > 0).astype(np.int64)
+    row = np.zeros(ROW_BITS // prec, dtype=np.int64)
+    row[: len(values)] = values & lane_mask
+    bits = ((row[:, None] >> np.arange(prec)) & 1).astype(np.uint8).reshape(-1)
+    return np.packbits(bits, bitorder="little")
+
+
+def mct(k, prec):
+    """Tail mask (`dimc_set_k`) of a reduction over `k` elements."""
+    valid_bits = (k * prec + 3) & ~3
+    return (ROW_BITS - valid_bits) // 4
+
+
+def tail_error(k, prec, signed):
+    """Offset a 1-bit compute over `k` elements adds to the true dot product.
+
+    In the 1-bit modes the zero padding up to the 4-bit MCT granularity counts
+    as matching, and so do the masked bits of the unsigned popcount.
+    """
+    if prec != 1:
+        return 0
+    valid_bits = (k * prec + 3) & ~3
+    pad = valid_bits - k
+    return pad if signed else ROW_BITS - k
+
+
+def pack(weights, prec, signed, n_dimc):
+    """Return the kernel images [n_tiles][k_tiles][n_dimc * 4 KiB], the MCT of
+    every K tile and the bias correction of the 1-bit modes."""
+    n, k = weights.shape
+    tile_n = NR_ROWS * n_dimc
+    tile_k = ROW_BITS // prec
+    n_tiles = -(-n // tile_n)
+    k_tiles = -(-k // tile_k)
+
+    images = np.zeros((n_tiles, k_tiles, n_dimc, NR_ROWS, ROW_BYTES), dtype=np.uint8)
+    for nt in range(n_tiles):
+        for kt in range(k_tiles):
+            k0 = kt * tile_k
+            for ch in range(min(tile_n, n - nt * tile_n)):
+                values = weights[nt * tile_n + ch, k0 : k0 + tile_k]
+                images[nt, kt, ch % n_dimc, ch // n_dimc] = pack_row(values, prec, signed)
+
+    k_lens = [min(tile_k, k - kt * tile_k) for kt in range(k_tiles)]
+    mcts = [mct(kl, prec) for kl in k_lens]
+    correction = sum(tail_error(kl, prec, signed) for kl in k_lens)
+    return images.reshape(n_tiles, k_tiles, -1), mcts, correction
+
+
+def array_to_cstr(a, fmt="{}", per_line=16):
+    els = [fmt.format(el) for el in np.asarray(a).flat]
+    lines = [", ".join(els[i : i + per_line]) for i in range(0, len(els), per_line)]
+    return "{\n    " + ",\n    ".join(lines) + "\n}"
+
+
+def emit_header_file(path, name, **kwargs):
+    images = kwargs["images"]
+    n_tiles, k_tiles, tile_bytes = images.shape
+    NAME = name.upper()
+
+    emit_str = (
+        "// Copyright 2023 ETH Zurich and University of Bologna.\n"
+        + "// Licensed under the Apache License, Version 2.0, see LICENSE for details.\n"
+        + "// SPDX-License-Identifier: Apache-2.0\n\n"
+        + "// This file was generated automatically.\n\n"
+        + "#pragma once\n#include <stdint.h>\n\n"
+    )
+
+    emit_str += f"// {kwargs['N']} output channels x {kwargs['K']} elements at {kwargs['prec']} bits\n"
+    emit_str += f"#define {NAME}_N {kwargs['N']}\n"
+    emit_str += f"#define {NAME}_K {kwargs['K']}\n"
+    emit_str += f"#define {NAME}_MODE {kwargs['mode']}\n"
+    emit_str += f"#define {NAME}_N_DIMC {kwargs['n_dimc']}\n"
+    emit_str += f"#define {NAME}_N_TILES {n_tiles}\n"
+    emit_str += f"#define {NAME}_K_TILES {k_tiles}\n"
+    emit_str += f"#define {NAME}_TILE_BYTES {tile_bytes}\n\n"
+
+    emit_str += (
+        "// Kernel memory image of every tile, N tile major\n"
+        + f"static const uint8_t {name}_kernel[{n_tiles * k_tiles}][{tile_bytes}]"
+        + ' __attribute__((aligned(32), section(".data"))) = {'
+    )
+    for tile in images.reshape(n_tiles * k_tiles, tile_bytes):
+        emit_str += "\n    " + array_to_cstr(tile, "0x{:02x}").replace("\n", "\n    ") + ","
+    emit_str = emit_str[:-1] + "\n};\n\n"
+
+    emit_str += "// Tail mask of every K tile (dimc_set_mct)\n"
+    emit_str += (
+        f"static const uint8_t {name}_mct[{k_tiles}] = "
+        + array_to_cstr(kwargs["mct"])
+        + ";\n\n"
+    )
+
+    emit_str += "// Partial sum input (ADDIN) of every output channel\n"
+    emit_str += (
+        f'static const int32_t {name}_bias[{len(kwargs["bias"])}] __attribute__((aligned(32), section(".data"))) = '
+        + array_to_cstr(kwargs["bias"])
+        + ";\n"
+    )
+
+    if kwargs["scale"] is not None:
+        emit_str += "\n// Quantization scale of every output channel\n"
+        emit_str += (
+            f"static const float {name}_scale[{len(kwargs['scale'])}] = "
+            + array_to_cstr(kwargs["scale"], "{:.8e}", per_line=4)
+            + ";\n"
+        )
+
+    with path.open("w") as f:
+        f.write(emit_str)
+
+
+def main():
+
+    parser = argparse.ArgumentParser(description="Pack weights into DIMC kernel-memory images")
+    parser.add_argument("weights", type=pathlib.Path, help="Weight tensor (.npy, .npz or .onnx)")
+    parser.add_argument("--key", help="Array of an .npz file or initializer of an .onnx model")
+    parser.add_argument("--bias", type=pathlib.Path, help="Bias tensor (.npy, .npz or .onnx)")
+    parser.add_argument("--bias-key", help="Array or initializer of the bias")
+    parser.add_argument("-p", "--prec", type=int, choices=[1, 2, 4, 8], default=8, help="Weight precision in bits")
+    parser.add_argument("--unsigned", action="store_true", help="Unsigned weights")
+    parser.add_argument(
+        "--transpose", action="store_true", help="The tensor is [K][N] (ONNX MatMul) instead of [N][...]"
+    )
+    parser.add_argument(
+        "--input-scale", type=float, default=1.0, help="Scale of the activations, to quantize float biases"
+    )
+    parser.add_argument("--n-dimc", type=int, choices=[1, 2, 4, 8], default=1, help="DIMC macros per core")
+    parser.add_argument("-n", "--name", default="weights", help="Name of the C symbols and the output files")
+    parser.add_argument(
+        "-o", "--outdir", type=pathlib.Path, default=pathlib.Path(__file__).parent.parent / "data", help="Output directory"
+    )
+    parser.add_argument("--bin", action="store_true", help="Also write the images and the biases as raw .bin files")
+
+    args = parser.parse_args()
+    signed = not args.unsigned
+
+    # Output channels first, everything else is the reduction (im2col order
+    # for convolution weights)
+    weights = load_tensor(args.weights, args.key)
+    if args.transpose:
+        weights = weights.T
+    weights = weights.reshape(weights.shape[0], -1)
+    n, k = weights.shape
+
+    q, scale = quantize(weights, args.prec, signed)
+    images, mcts, correction = pack(q, args.prec, signed, args.n_dimc)
+
+    bias = np.zeros(n)
+    if args.bias is not None:
+        bias = load_tensor(args.bias, args.bias_key).reshape(-1)
+        if not np.issubdtype(bias.dtype, np.integer):
+            bias = np.rint(bias / (scale * args.input_scale))
+    bias = bias.astype(np.int64) - correction
+    if bias.min() < ACC_MIN or bias.max() > ACC_MAX:
+        raise SystemExit("bias does not fit the 24-bit DIMC accumulator")
+    # One entry per channel of the last N tile, so whole DMV groups can be read
+    bias = np.pad(bias, (0, images.shape[0] * NR_ROWS * args.n_dimc - n)).astype(np.int32)
+
+    mode = MODES[args.prec] | (SIGNED if signed else 0)
+    args.outdir.mkdir(parents=True, exist_ok=True)
+    emit_header_file(
+        args.outdir / f"{args.name}.h",
+        args.name,
+        images=images,
+        mct=mcts,
+        bias=bias,
+        scale=None if np.issubdtype(weights.dtype, np.integer) else scale.astype(np.float32),
+        N=n,
+        K=k,
+        prec=args.prec,
+        mode=mode,
+        n_dimc=args.n_dimc,
+    )
+    if args.bin:
+        images.tofile(args.outdir / f"{args.name}_kernel.bin")
+        bias.astype("<i4").tofile(args.outdir / f"{args.name}_bias.bin")
+
+
+if __name__ == "__main__":
+    main()
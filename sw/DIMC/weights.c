@@ -0,0 +1,121 @@
+// Copyright 2020 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <snrt.h>
+#include "printf.h"
+#include "dimc.h"
+
+// Kernel-memory images packed offline by script/pack_weights.py. The core
+// with the DMA loads them into the DIMC of core 0 with
+// snrt_dimc_load_weights_async, core 0 runs one DMV per K tile, and the
+// results are checked against a dot product over the original weights, so the
+// packed layout is verified end to end.
+//
+// data/dense.h holds w[n][k] = dense_weight(n, k) and b[n] = dense_bias_ref(n)
+// (32 x 160, signed 8-bit), saved as .npy files and packed with
+//   pack_weights.py dense_w.npy --bias dense_b.npy -n dense
+#include "data/dense.h"
+
+#if DENSE_N_DIMC != DIMC_NR_MACROS
+#error "data/dense.h was packed for a different number of DIMC macros"
+#endif
+
+// x is zero past DENSE_K, like the last K tile of the image
+#define DENSE_K_PAD (DENSE_K_TILES * DIMC_NR_SECTIONS * 32)
+
+static inline int32_t dense_weight(uint32_t n, uint32_t k) {
+    return (int32_t)((n * 37 + k * 11) % 255) - 127;
+}
+
+static inline int32_t dense_bias_ref(uint32_t n) {
+    return (int32_t)n * 1000 - 16000;
+}
+
+static inline int8_t dense_feature(uint32_t k) {
+    return (int8_t)((int32_t)((k * 13 + 5) % 61) - 30);
+}
+
+static int8_t *x;
+static int32_t *y;
+static uint8_t *tile;
+
+// One K tile of the feature vector, zero-padded to a full row
+static inline void dense_ld_f(const int8_t *f) {
+    size_t vl;
+    asm volatile("vsetvli %0, %1, e8, m1, ta, ma" : "=r"(vl) : "r"(32));
+    asm volatile("vle8.v v4, (%0)" ::"r"(f));
+    asm volatile("vle8.v v5, (%0)" ::"r"(f + 32));
+    asm volatile("vle8.v v6, (%0)" ::"r"(f + 64));
+    asm volatile("vle8.v v7, (%0)" ::"r"(f + 96));
+    dimc_ld_f(4, 0);
+    dimc_ld_f(5, 1);
+    dimc_ld_f(6, 2);
+    dimc_ld_f(7, 3);
+}
+
+static int verify() {
+    int errors = 0;
+    for (uint32_t n = 0; n < DENSE_N; ++n) {
+        int32_t golden = dense_bias_ref(n);
+        for (uint32_t k = 0; k < DENSE_K; ++k)
+            golden += dense_weight(n, k) * (int32_t)dense_feature(k);
+        if (y[n] != golden) {
+            if (errors < 4)
+                printf("  y[%u] = %d, expected %d\n", n, y[n], golden);
+            ++errors;
+        }
+    }
+    return errors;
+}
+
+int main() {
+    const unsigned int cid = snrt_cluster_core_idx();
+    int errors = 0;
+
+    if (cid == 0) {
+        x = (int8_t *)snrt_l1alloc(DENSE_K_PAD);
+        y = (int32_t *)snrt_l1alloc(DIMC_MV_RESULTS * sizeof(int32_t));
+        tile = (uint8_t *)snrt_l1alloc(DENSE_TILE_BYTES);
+        for (uint32_t k = 0; k < DENSE_K_PAD; ++k)
+            x[k] = k < DENSE_K ? dense_feature(k) : 0;
+        for (uint32_t n = 0; n < DIMC_MV_RESULTS; ++n) y[n] = dense_bias[n];
+        dimc_set_output(DIMC_ACT_NONE, DIMC_OUT_RAW);
+    }
+    snrt_cluster_hw_barrier();
+
+    for (uint32_t kt = 0; kt < DENSE_K_TILES; ++kt) {
+        // Stage the tile in the TCDM and load it into the kernel memory
+        if (snrt_is_xdma_core()) {
+            snrt_dma_start_1d(tile, dense_kernel[kt], DENSE_TILE_BYTES);
+            snrt_dma_wait_all();
+            snrt_dimc_wait(snrt_dimc_load_weights_async(
+                0, 0, 0, 0, tile, DENSE_TILE_BYTES / SNRT_DIMC_SECTION_SIZE));
+        }
+        snrt_cluster_hw_barrier();
+
+        // Add the products of this tile to the partial sums in y
+        if (cid == 0) {
+            size_t vl;
+            dense_ld_f(x + kt * DIMC_NR_SECTIONS * 32);
+            dimc_set_mct(dense_mct[kt]);
+            asm volatile("vsetvli %0, %1, e32, m4, ta, ma"
+                         : "=r"(vl)
+                         : "r"(DIMC_MV_RESULTS));
+            asm volatile("vle32.v v8, (%0)" ::"r"(y));
+            dimc_mv_acc(8, 0, DENSE_MODE);
+            asm volatile("vse32.v v8, (%0)" ::"r"(y) : "memory");
+        }
+        snrt_cluster_hw_barrier();
+    }
+
+    if (cid == 0) {
+        dimc_set_mct(0);
+        errors = verify();
+        printf("%ux%u packed weights, %u K tiles: %d errors\n", DENSE_N,
+               DENSE_K, DENSE_K_TILES, errors);
+    }
+
+    snrt_cluster_hw_barrier();
+    return errors;
+}
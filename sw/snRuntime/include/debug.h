@@ -19,6 +19,7 @@ extern "C" {
 
 #define SNRT_TRACE_INIT 0
 #define SNRT_TRACE_ALLOC 1
+#define SNRT_TRACE_DMA 2
 
 #define snrt_trace(trace, x...) \
     do {                        \
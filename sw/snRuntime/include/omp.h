@@ -56,16 +56,34 @@
 // types
 //================================================================================
 
+#ifndef OMPSTATIC_NUMTHREADS
+/**
+ * @brief Dynamically scheduled loops that can be in progress at the same time.
+ * With `nowait`, threads enter the next loop while others are still working on
+ * the previous one.
+ */
+#define OMP_DISPATCH_BUFS 4
+
+/**
+ * @brief Shared state of a dynamically scheduled loop. The loop parameters are
+ * the same for all threads, each thread keeps its own copy.
+ */
+typedef struct {
+    // Loop of the parallel region, counted from 1, that may use the buffer
+    volatile uint32_t loop;
+    // Next chunk to hand out, claimed with an AMO
+    volatile uint32_t next;
+    // Threads that found the loop exhausted
+    volatile uint32_t fini;
+} omp_dispatch_t;
+#endif
+
 typedef struct {
     char nbThreads;
 #ifndef OMPSTATIC_NUMTHREADS
-    int loop_epoch;
-    int loop_start;
-    int loop_end;
-    int loop_incr;
-    int loop_chunk;
-    int loop_is_setup;
-    int core_epoch[16];  // for dynamic scheduling
+    omp_dispatch_t dispatch[OMP_DISPATCH_BUFS];
+    // Dynamically scheduled loops entered by each thread in this region
+    uint32_t core_loop[16];
 #endif
 } omp_team_t;
 
@@ -61,6 +61,18 @@ enum snrt_perf_cnt_type {
     SNRT_PERF_CNT_ICACHE_PREFETCH,
     SNRT_PERF_CNT_ICACHE_DOUBLE_HIT,
     SNRT_PERF_CNT_ICACHE_STALL,
+    SNRT_PERF_CNT_DIMC,
+};
+
+/// DIMC events counted with `SNRT_PERF_CNT_DIMC`
+// Must match with `DIMC_EVENT_SELECT` of `spatz_cluster_peripheral`
+enum snrt_perf_cnt_dimc_event {
+    SNRT_PERF_CNT_DIMC_COMPUTE,
+    SNRT_PERF_CNT_DIMC_LD_F,
+    SNRT_PERF_CNT_DIMC_LD_K,
+    SNRT_PERF_CNT_DIMC_STALL_READY,
+    SNRT_PERF_CNT_DIMC_STALL_FIFO,
+    SNRT_PERF_CNT_DIMC_WB_CONFLICT,
 };
 
 typedef union {
@@ -76,6 +88,9 @@ typedef struct {
 void snrt_start_perf_counter(enum snrt_perf_cnt perf_cnt,
                              enum snrt_perf_cnt_type perf_cnt_type,
                              uint32_t hart_id);
+void snrt_start_perf_counter_dimc(enum snrt_perf_cnt perf_cnt,
+                                  enum snrt_perf_cnt_dimc_event event,
+                                  uint32_t hart_id);
 void snrt_stop_perf_counter(enum snrt_perf_cnt perf_cnt);
 void snrt_reset_perf_counter(enum snrt_perf_cnt);
 uint32_t snrt_get_perf_counter(enum snrt_perf_cnt perf_cnt);
@@ -0,0 +1,129 @@
+// Copyright 2020 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "snrt.h"
+
+// A pipeline streams a sequence of tiles between external memory and a ring of
+// TCDM slots. The DM core moves the tiles with the cluster DMA while the
+// compute cores work on the slots that are ready, so that with two or more
+// slots the transfers of the next tiles overlap the compute on the current
+// one.
+//
+// Typical use, for an input pipeline consumed by all compute cores:
+//
+//     if (snrt_is_dm_core()) snrt_pipeline_init(&p, ...);
+//     snrt_cluster_hw_barrier();
+//     if (snrt_is_dm_core()) {
+//         snrt_pipeline_t *ps[] = {&p};
+//         snrt_pipeline_dm_run(ps, 1);
+//     } else {
+//         for (uint32_t t = 0; t < nr_tiles; t++) {
+//             void *tile = snrt_pipeline_acquire(&p, t);
+//             ...
+//             snrt_pipeline_release(&p, t);
+//         }
+//     }
+
+#define SNRT_PIPELINE_MAX_SLOTS 4
+
+typedef enum {
+    // Tiles are loaded into the TCDM and read by the compute cores
+    SNRT_PIPELINE_IN,
+    // Tiles are written by the compute cores and stored to external memory
+    SNRT_PIPELINE_OUT,
+} snrt_pipeline_dir_t;
+
+/// Placement of the tiles in external memory. Tile `t` consists of `repeat`
+/// rows of `size` bytes, `stride` bytes apart, starting at
+/// `base + t * tile_stride`. In a TCDM slot the rows are packed.
+typedef struct {
+    uint64_t base;
+    size_t tile_stride;
+    size_t size;
+    size_t stride;
+    size_t repeat;
+} snrt_pipeline_layout_t;
+
+typedef struct {
+    snrt_pipeline_dir_t dir;
+    snrt_pipeline_layout_t layout;
+    uint32_t nr_tiles;
+    uint32_t nr_slots;
+    // Compute cores that release every tile
+    uint32_t nr_consumers;
+    void *slot[SNRT_PIPELINE_MAX_SLOTS];
+
+    // DM core only: tiles handed to the DMA and their transfer ids, and tiles
+    // released by all consumers
+    uint32_t issued;
+    snrt_dma_txid_t txid[SNRT_PIPELINE_MAX_SLOTS];
+    uint32_t retired;
+
+    // In: tiles that arrived in the TCDM. Out: tiles that reached external
+    // memory, freeing their slot.
+    volatile uint32_t done;
+    // Releases of the tile in each slot by the compute cores
+    volatile uint32_t released[SNRT_PIPELINE_MAX_SLOTS];
+} snrt_pipeline_t;
+
+/**
+ * @brief Set up a pipeline and allocate its slots in the TCDM
+ * @details Call on one core, before the other cores use the pipeline.
+ *
+ * @param nr_slots number of TCDM slots, 2 for double buffering, up to
+ * SNRT_PIPELINE_MAX_SLOTS
+ * @param nr_consumers number of compute cores that release each tile
+ * @return 0 on success, -1 if the TCDM is exhausted
+ */
+int snrt_pipeline_init(snrt_pipeline_t *p, snrt_pipeline_dir_t dir,
+                       const snrt_pipeline_layout_t *layout,
+                       uint32_t nr_tiles, uint32_t nr_slots,
+                       uint32_t nr_consumers);
+
+/**
+ * @brief Free the TCDM slots of a pipeline
+ */
+void snrt_pipeline_free(snrt_pipeline_t *p);
+
+/**
+ * @brief Make progress on the DMA transfers of a pipeline; DM core only
+ * @details Starts every transfer whose slot is available and waits for the
+ * oldest transfer in flight.
+ *
+ * @return 0 once all tiles have been transferred
+ */
+int snrt_pipeline_dm_step(snrt_pipeline_t *p);
+
+/**
+ * @brief Run the DMA transfers of several pipelines until they are all done;
+ * DM core only
+ */
+void snrt_pipeline_dm_run(snrt_pipeline_t *const *p, uint32_t num);
+
+/**
+ * @brief Wait until tile `tile` can be used by the calling compute core
+ * @details For an input pipeline the tile has arrived in its slot, for an
+ * output pipeline the slot's previous tile has been stored.
+ *
+ * @return TCDM slot of the tile
+ */
+static inline void *snrt_pipeline_acquire(snrt_pipeline_t *p, uint32_t tile) {
+    if (p->dir == SNRT_PIPELINE_IN)
+        while (__atomic_load_n(&p->done, __ATOMIC_ACQUIRE) <= tile)
+            ;
+    else
+        while (tile >= __atomic_load_n(&p->done, __ATOMIC_ACQUIRE) +
+                           p->nr_slots)
+            ;
+    return p->slot[tile % p->nr_slots];
+}
+
+/**
+ * @brief Hand tile `tile` back to the DM core once the calling compute core is
+ * done with it
+ */
+static inline void snrt_pipeline_release(snrt_pipeline_t *p, uint32_t tile) {
+    __atomic_add_fetch(&p->released[tile % p->nr_slots], 1, __ATOMIC_RELEASE);
+}
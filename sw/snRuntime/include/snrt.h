@@ -31,12 +31,6 @@ extern "C" {
 #define snrt_max(a, b) ((a) > (b) ? (a) : (b))
 #endif
 
-inline static void *snrt_memset(void *ptr, int value, size_t num) {
-    for (uint32_t i = 0; i < num; ++i)
-        *((uint8_t *)ptr + i) = (unsigned char)value;
-    return ptr;
-}
-
 /// A slice of memory.
 typedef struct snrt_slice {
     uint64_t start;
@@ -52,12 +46,20 @@ struct snrt_peripherals {
      *
      */
     volatile uint32_t *cl_clint;
+    /**
+     * @brief DIMC kernel memory window, written by the DMA only
+     *
+     */
+    uint32_t dimc_kernel;
 };
 
-/// Barrier to use with snrt_barrier
+/// Barrier to use with snrt_barrier or snrt_sleep_barrier
 struct snrt_barrier {
     uint32_t volatile barrier;
     uint32_t volatile barrier_iteration;
+    // Cluster cores sleeping until the next iteration, one bit per core, only
+    // used by snrt_sleep_barrier
+    uint32_t volatile sleepers;
 };
 
 static inline size_t snrt_slice_len(snrt_slice_t s) { return s.end - s.start; }
@@ -66,6 +68,7 @@ extern void snrt_cluster_hw_barrier();
 extern void snrt_cluster_sw_barrier();
 extern void snrt_global_barrier();
 extern void snrt_barrier(struct snrt_barrier *barr, uint32_t n);
+extern void snrt_sleep_barrier(struct snrt_barrier *barr, uint32_t n);
 
 static inline uint32_t __attribute__((pure)) snrt_hartid();
 struct snrt_team_root *snrt_current_team();
@@ -88,6 +91,10 @@ extern uint32_t snrt_cluster_idx();
 extern uint32_t snrt_cluster_num();
 extern int snrt_is_compute_core();
 extern int snrt_is_dm_core();
+/// Core that owns the cluster DMA (Xdma) in the cluster config. It need not be
+/// the DM core, which is the last core.
+extern uint32_t snrt_cluster_xdma_core_idx();
+extern int snrt_is_xdma_core();
 extern void snrt_wakeup(uint32_t mask);
 
 /// get pointer to barrier register
@@ -104,10 +111,13 @@ extern void snrt_bcast_send(void *data, size_t len);
 extern void snrt_bcast_recv(void *data, size_t len);
 
 extern void *snrt_memcpy(void *dst, const void *src, size_t n);
+extern void *snrt_memset(void *ptr, int value, size_t num);
 
 /// DMA runtime functions.
 /// A DMA transfer identifier.
 typedef uint32_t snrt_dma_txid_t;
+/// Returned for a transfer that was rejected. Waiting on it returns at once.
+#define SNRT_DMA_TXID_INVALID ((snrt_dma_txid_t)-1)
 /// Initiate an asynchronous 1D DMA transfer with wide 64-bit pointers.
 extern snrt_dma_txid_t snrt_dma_start_1d_wideptr(uint64_t dst, uint64_t src,
                                                  size_t size);
@@ -123,11 +133,43 @@ extern snrt_dma_txid_t snrt_dma_start_2d_wideptr(uint64_t dst, uint64_t src,
 extern snrt_dma_txid_t snrt_dma_start_2d(void *dst, const void *src,
                                          size_t size, size_t dst_stride,
                                          size_t src_stride, size_t repeat);
+/// Maximum number of dimensions of an N-dimensional DMA transfer.
+#define SNRT_DMA_MAX_DIMS 4
+/// Initiate an asynchronous N-dimensional DMA transfer with wide 64-bit
+/// pointers. Returns SNRT_DMA_TXID_INVALID without transferring anything if
+/// `ndims` exceeds SNRT_DMA_MAX_DIMS.
+extern snrt_dma_txid_t snrt_dma_start_nd_wideptr(uint64_t dst, uint64_t src,
+                                                 size_t size,
+                                                 const size_t *dst_strides,
+                                                 const size_t *src_strides,
+                                                 const size_t *repeats,
+                                                 uint32_t ndims);
+/// Initiate an asynchronous N-dimensional DMA transfer.
+extern snrt_dma_txid_t snrt_dma_start_nd(void *dst, const void *src,
+                                         size_t size, const size_t *dst_strides,
+                                         const size_t *src_strides,
+                                         const size_t *repeats, uint32_t ndims);
 /// Block until a transfer finishes.
 extern void snrt_dma_wait(snrt_dma_txid_t tid);
 /// Block until all operation on the DMA ceases.
 extern void snrt_dma_wait_all();
 
+/// DIMC kernel memory loading through the DMA.
+/// A DIMC weight transfer identifier.
+typedef snrt_dma_txid_t snrt_dimc_txid_t;
+/// Size of one DIMC kernel section in bytes.
+#define SNRT_DIMC_SECTION_SIZE 32
+/// Initiate an asynchronous transfer of `nr_sections` kernel sections from
+/// `src` into DIMC macro `macro` of compute core `core_idx`, starting at
+/// section `sec` of row `row`.
+extern snrt_dimc_txid_t snrt_dimc_load_weights_async(uint32_t core_idx,
+                                                     uint32_t macro,
+                                                     uint32_t row, uint32_t sec,
+                                                     const void *src,
+                                                     size_t nr_sections);
+/// Block until a weight transfer has reached the kernel memory.
+static inline void snrt_dimc_wait(snrt_dimc_txid_t tid) { snrt_dma_wait(tid); }
+
 /**
  * @brief Use as replacement of the stdlib exit() call
  *
@@ -153,8 +195,22 @@ static inline uint32_t __attribute__((pure)) snrt_hartid() {
 // Allocation functions
 //================================================================================
 extern void snrt_alloc_init(struct snrt_team_root *team, uint32_t l3off);
+// Width of one TCDM bank in bytes
+#define SNRT_TCDM_BANK_WIDTH 8
+typedef uint32_t snrt_l1_mark_t;
 extern void *snrt_l1alloc(size_t size);
+extern void *snrt_l1alloc_aligned(size_t size, size_t align);
+extern void *snrt_l1alloc_banked(size_t size, uint32_t bank_offset);
+extern int snrt_l1alloc_staggered(void **ptrs, const size_t *sizes,
+                                  uint32_t num);
+extern uint32_t snrt_l1_bank_stagger(uint32_t idx, uint32_t num);
+extern void snrt_l1free(void *ptr);
+extern snrt_l1_mark_t snrt_l1_mark();
+extern void snrt_l1_release(snrt_l1_mark_t mark);
+extern uint32_t snrt_l1_bank_num();
+extern uint32_t snrt_l1_bank_row();
 extern void *snrt_l3alloc(size_t size);
+extern void snrt_l3free(void *ptr);
 
 //================================================================================
 // Interrupt functions
@@ -269,6 +325,18 @@ static inline void snrt_mutex_release(volatile uint32_t *pmtx) {
                  : "+r"(pmtx));
 }
 
+/// Mutex whose waiters sleep in wfi instead of polling, for locks that can be
+/// held for long. Declare with `static snrt_sleep_mutex_t mtx = {0};`. Only
+/// cores of the same cluster can share it.
+typedef struct {
+    volatile uint32_t lock;
+    // Cluster cores sleeping until the mutex is released, one bit per core
+    volatile uint32_t sleepers;
+} snrt_sleep_mutex_t;
+
+extern void snrt_sleep_mutex_lock(snrt_sleep_mutex_t *m);
+extern void snrt_sleep_mutex_release(snrt_sleep_mutex_t *m);
+
 //================================================================================
 // Runtime functions
 //================================================================================
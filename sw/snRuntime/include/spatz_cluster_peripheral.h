@@ -55,6 +55,7 @@ extern "C" {
 #define SPATZ_CLUSTER_PERIPHERAL_PERF_COUNTER_ENABLE_0_ICACHE_DOUBLE_HIT_0_BIT \
   29
 #define SPATZ_CLUSTER_PERIPHERAL_PERF_COUNTER_ENABLE_0_ICACHE_STALL_0_BIT 30
+#define SPATZ_CLUSTER_PERIPHERAL_PERF_COUNTER_ENABLE_0_DIMC_0_BIT 31
 
 // Enable particular performance counter and start tracking.
 #define SPATZ_CLUSTER_PERIPHERAL_PERF_COUNTER_ENABLE_1_REG_OFFSET 0x8
@@ -90,6 +91,7 @@ extern "C" {
 #define SPATZ_CLUSTER_PERIPHERAL_PERF_COUNTER_ENABLE_1_ICACHE_DOUBLE_HIT_1_BIT \
   29
 #define SPATZ_CLUSTER_PERIPHERAL_PERF_COUNTER_ENABLE_1_ICACHE_STALL_1_BIT 30
+#define SPATZ_CLUSTER_PERIPHERAL_PERF_COUNTER_ENABLE_1_DIMC_1_BIT 31
 
 // Select from which hart in the cluster, starting from `0`,
 #define SPATZ_CLUSTER_PERIPHERAL_HART_SELECT_HART_SELECT_FIELD_WIDTH 10
@@ -201,6 +203,39 @@ extern "C" {
       .mask = SPATZ_CLUSTER_PERIPHERAL_CLUSTER_EOC_EXIT_EOC_EXIT_MASK,         \
       .index = SPATZ_CLUSTER_PERIPHERAL_CLUSTER_EOC_EXIT_EOC_EXIT_OFFSET})
 
+// Select the DIMC event counted by a performance counter with
+#define SPATZ_CLUSTER_PERIPHERAL_DIMC_EVENT_SELECT_DIMC_EVENT_SELECT_FIELD_WIDTH \
+  3
+#define SPATZ_CLUSTER_PERIPHERAL_DIMC_EVENT_SELECT_DIMC_EVENT_SELECT_FIELDS_PER_REG \
+  21
+#define SPATZ_CLUSTER_PERIPHERAL_DIMC_EVENT_SELECT_MULTIREG_COUNT 2
+
+// Select the DIMC event counted by a performance counter with
+#define SPATZ_CLUSTER_PERIPHERAL_DIMC_EVENT_SELECT_0_REG_OFFSET 0x68
+#define SPATZ_CLUSTER_PERIPHERAL_DIMC_EVENT_SELECT_0_DIMC_EVENT_SELECT_0_MASK \
+  0x7
+#define SPATZ_CLUSTER_PERIPHERAL_DIMC_EVENT_SELECT_0_DIMC_EVENT_SELECT_0_OFFSET \
+  0
+#define SPATZ_CLUSTER_PERIPHERAL_DIMC_EVENT_SELECT_0_DIMC_EVENT_SELECT_0_FIELD \
+  ((bitfield_field32_t){                                                       \
+      .mask =                                                                  \
+          SPATZ_CLUSTER_PERIPHERAL_DIMC_EVENT_SELECT_0_DIMC_EVENT_SELECT_0_MASK, \
+      .index =                                                                 \
+          SPATZ_CLUSTER_PERIPHERAL_DIMC_EVENT_SELECT_0_DIMC_EVENT_SELECT_0_OFFSET})
+
+// Select the DIMC event counted by a performance counter with
+#define SPATZ_CLUSTER_PERIPHERAL_DIMC_EVENT_SELECT_1_REG_OFFSET 0x70
+#define SPATZ_CLUSTER_PERIPHERAL_DIMC_EVENT_SELECT_1_DIMC_EVENT_SELECT_1_MASK \
+  0x7
+#define SPATZ_CLUSTER_PERIPHERAL_DIMC_EVENT_SELECT_1_DIMC_EVENT_SELECT_1_OFFSET \
+  0
+#define SPATZ_CLUSTER_PERIPHERAL_DIMC_EVENT_SELECT_1_DIMC_EVENT_SELECT_1_FIELD \
+  ((bitfield_field32_t){                                                       \
+      .mask =                                                                  \
+          SPATZ_CLUSTER_PERIPHERAL_DIMC_EVENT_SELECT_1_DIMC_EVENT_SELECT_1_MASK, \
+      .index =                                                                 \
+          SPATZ_CLUSTER_PERIPHERAL_DIMC_EVENT_SELECT_1_DIMC_EVENT_SELECT_1_OFFSET})
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
@@ -18,12 +18,29 @@ struct snrt_allocator_inst {
     uint32_t base;
     // Number of bytes alloctable
     uint32_t size;
-    // Address of the next allocated block
+    // Top of the heap, everything above is unused
     uint32_t next;
+    // Free blocks below the top, sorted by address and coalesced
+    uint32_t free;
+};
+
+// Small L1 blocks are served from exact-fit free lists of power-of-two sizes,
+// from 8 bytes up to 8 << (SNRT_L1_NR_CLASSES - 1) bytes
+#define SNRT_L1_NR_CLASSES 8
+
+struct snrt_l1_allocator {
+    struct snrt_allocator_inst heap;
+    // Free blocks of each size class, singly linked
+    uint32_t free_small[SNRT_L1_NR_CLASSES];
+};
+// The L3 heap is a single instance in DRAM, shared by all clusters
+struct snrt_l3_allocator {
+    struct snrt_allocator_inst heap;
+    // Taken by the hart that modifies the heap
+    volatile uint32_t lock;
 };
 struct snrt_allocator {
-    struct snrt_allocator_inst l1;
-    struct snrt_allocator_inst l3;
+    struct snrt_l1_allocator l1;
 };
 
 // This struct is placed at the end of each clusters TCDM
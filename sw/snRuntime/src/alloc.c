@@ -10,67 +10,525 @@
 
 #define MIN_CHUNK_SIZE 8
 
+#ifndef SNRT_TCDM_BANK_NUM
+#define SNRT_TCDM_BANK_NUM 16
+#endif
+
+//================================================================================
+// Heap
+//================================================================================
+//
+// Every block is preceded by a header holding its payload size. Free blocks
+// live on an address-sorted list with first-fit placement, splitting and
+// coalescing. Blocks freed at the top of the heap shrink it, so stack-like
+// usage never leaves holes behind. On top of that, the L1 heap rounds requests
+// up to SMALL_MAX bytes to a power-of-two size class and recycles them through
+// exact-fit free lists, which keeps the common small allocations O(1). When
+// the heap runs out, these lists are drained back into the heap, where the
+// blocks coalesce with their neighbours, and the allocation is retried.
+
+struct heap_block {
+    // Payload size in bytes
+    uint32_t size;
+    // Next free block, only valid while the block is on a free list
+    uint32_t next;
+};
+
+#define BLOCK_HDR sizeof(struct heap_block)
+#define SMALL_MAX (MIN_CHUNK_SIZE << (SNRT_L1_NR_CLASSES - 1))
+
+static inline struct heap_block *heap_block(uint32_t addr) {
+    return (struct heap_block *)addr;
+}
+
+static inline uint32_t heap_block_end(uint32_t addr) {
+    return addr + BLOCK_HDR + heap_block(addr)->size;
+}
+
 /**
- * @brief Allocate a chunk of memory in the L1 memory
- * @details This currently does not support free-ing of memory
- *
- * @param size number of bytes to allocate
- * @return pointer to the allocated memory
+ * @brief Give the highest free block back to the top of the heap if it
+ * ends there
  */
-void *snrt_l1alloc(size_t size) {
-    struct snrt_allocator_inst *alloc = &snrt_current_team()->allocator.l1;
+static void heap_trim_top(struct snrt_allocator_inst *heap) {
+    uint32_t *link = &heap->free;
+    while (*link && heap_block(*link)->next) link = &heap_block(*link)->next;
+    if (*link && heap_block_end(*link) == heap->next) {
+        heap->next = *link;
+        *link = 0;
+    }
+}
+
+/**
+ * @brief Insert a block into the free list, merging it with its
+ * neighbours
+ */
+static void heap_insert(struct snrt_allocator_inst *heap, uint32_t addr) {
+    uint32_t *link = &heap->free;
+    uint32_t prev = 0;
+    while (*link && *link < addr) {
+        prev = *link;
+        link = &heap_block(*link)->next;
+    }
+
+    struct heap_block *b = heap_block(addr);
+    b->next = *link;
+    *link = addr;
+
+    if (b->next && heap_block_end(addr) == b->next) {
+        b->size += BLOCK_HDR + heap_block(b->next)->size;
+        b->next = heap_block(b->next)->next;
+    }
+    if (prev && heap_block_end(prev) == addr) {
+        heap_block(prev)->size += BLOCK_HDR + b->size;
+        heap_block(prev)->next = b->next;
+    }
+}
+
+/**
+ * @brief Payload address at `offset` modulo `align` for a block whose header
+ * would start at `addr`.
+ * @details A gap in front of the payload must either be empty or be large
+ * enough to become a free block of its own.
+ */
+static inline uint32_t heap_place(uint32_t addr, uint32_t align,
+                                uint32_t offset) {
+    uint32_t payload = ALIGN_UP(addr + BLOCK_HDR - offset, align) + offset;
+    uint32_t gap = payload - BLOCK_HDR - addr;
+    if (gap && gap < BLOCK_HDR + MIN_CHUNK_SIZE) payload += align;
+    return payload;
+}
+
+/**
+ * @brief Whether `size` bytes at `payload` fit between `start` and `end`
+ * @details Compares distances instead of end addresses, so neither a payload
+ * that wrapped around while being aligned nor a huge size can overflow.
+ */
+static inline int heap_fits(uint32_t payload, uint32_t size, uint32_t start,
+                            uint32_t end) {
+    return payload - start <= end - start && size <= end - payload;
+}
+
+/**
+ * @brief Request size rounded up to whole chunks, 0 if that overflows
+ */
+static inline uint32_t heap_chunk_size(size_t size) {
+    if (size > UINT32_MAX - (MIN_CHUNK_SIZE - 1)) return 0;
+    return size ? ALIGN_UP(size, MIN_CHUNK_SIZE) : MIN_CHUNK_SIZE;
+}
+
+/**
+ * @brief Carve an aligned block out of the free list, first fit
+ */
+static void *heap_alloc_fit(struct snrt_allocator_inst *heap, uint32_t size,
+                          uint32_t align, uint32_t offset) {
+    for (uint32_t *link = &heap->free; *link;
+         link = &heap_block(*link)->next) {
+        uint32_t addr = *link;
+        uint32_t end = heap_block_end(addr);
+        uint32_t payload = heap_place(addr, align, offset);
+        if (!heap_fits(payload, size, addr, end)) continue;
 
-    size = ALIGN_UP(size, MIN_CHUNK_SIZE);
+        *link = heap_block(addr)->next;
 
-    if (alloc->next + size > alloc->base + alloc->size) {
+        // Leading gap and trailing remainder go back to the free list
+        if (payload - BLOCK_HDR != addr) {
+            heap_block(addr)->size = payload - BLOCK_HDR - addr - BLOCK_HDR;
+            heap_insert(heap, addr);
+        }
+        if (end - (payload + size) >= BLOCK_HDR + MIN_CHUNK_SIZE) {
+            uint32_t rest = payload + size;
+            heap_block(rest)->size = end - rest - BLOCK_HDR;
+            heap_insert(heap, rest);
+        } else {
+            size = end - payload;
+        }
+
+        heap_block(payload - BLOCK_HDR)->size = size;
+        return (void *)payload;
+    }
+    return 0;
+}
+
+/**
+ * @brief Carve an aligned block from the top of the heap
+ */
+static void *heap_alloc_top(struct snrt_allocator_inst *heap, uint32_t size,
+                          uint32_t align, uint32_t offset) {
+    uint32_t payload = heap_place(heap->next, align, offset);
+
+    if (!heap_fits(payload, size, heap->next, heap->base + heap->size)) {
         snrt_trace(
             SNRT_TRACE_ALLOC,
             "Not enough memory to allocate: base %#x size %#x next %#x\n",
-            alloc->base, alloc->size, alloc->next);
+            heap->base, heap->size, heap->next);
         return 0;
     }
 
-    void *ret = (void *)alloc->next;
-    alloc->next += size;
-    return ret;
+    if (payload - BLOCK_HDR != heap->next) {
+        heap_block(heap->next)->size =
+            payload - BLOCK_HDR - heap->next - BLOCK_HDR;
+        heap_insert(heap, heap->next);
+    }
+
+    heap_block(payload - BLOCK_HDR)->size = size;
+    heap->next = payload + size;
+    return (void *)payload;
+}
+
+//================================================================================
+// L1 heap
+//================================================================================
+
+static inline struct snrt_l1_allocator *l1_allocator() {
+    return &snrt_current_team()->allocator.l1;
+}
+
+static inline uint32_t l1_class(uint32_t size) {
+    uint32_t cls = 0;
+    while ((MIN_CHUNK_SIZE << cls) < size) cls++;
+    return cls;
+}
+
+static inline int l1_is_class_size(uint32_t size) {
+    return size <= SMALL_MAX && (size & (size - 1)) == 0;
+}
+
+/**
+ * @brief Give the blocks held on the size-class lists back to the heap
+ * @details They coalesce with free neighbours and with the top of the heap,
+ * so memory freed through one class is available to any size again.
+ *
+ * @return 1 if any block was returned
+ */
+static int l1_drain_small(struct snrt_l1_allocator *alloc) {
+    int drained = 0;
+    for (uint32_t cls = 0; cls < SNRT_L1_NR_CLASSES; cls++) {
+        while (alloc->free_small[cls]) {
+            uint32_t addr = alloc->free_small[cls];
+            alloc->free_small[cls] = heap_block(addr)->next;
+            heap_insert(&alloc->heap, addr);
+            drained = 1;
+        }
+    }
+    if (drained) heap_trim_top(&alloc->heap);
+    return drained;
+}
+
+/**
+ * @brief Carve a block out of the L1 heap, draining the size-class lists
+ * once if neither a free block nor the top of the heap fits it
+ */
+static void *l1_alloc(struct snrt_l1_allocator *alloc, uint32_t size,
+                      uint32_t align, uint32_t offset) {
+    struct snrt_allocator_inst *heap = &alloc->heap;
+    void *ret = heap_alloc_fit(heap, size, align, offset);
+    if (ret) return ret;
+    if (!heap_fits(heap_place(heap->next, align, offset), size, heap->next,
+                   heap->base + heap->size) &&
+        l1_drain_small(alloc)) {
+        ret = heap_alloc_fit(heap, size, align, offset);
+        if (ret) return ret;
+    }
+    return heap_alloc_top(heap, size, align, offset);
 }
 
+
+/**
+ * @brief Allocate a chunk of memory in the L1 memory
+ * @details Allocations are 8-byte aligned. Release them with `snrt_l1free` or
+ * in bulk with `snrt_l1_release`. The L1 heap is not thread-safe.
+ *
+ * @param size number of bytes to allocate
+ * @return pointer to the allocated memory, 0 if the TCDM is exhausted
+ */
+void *snrt_l1alloc(size_t size) {
+    struct snrt_l1_allocator *alloc = l1_allocator();
+
+    if (size > SMALL_MAX)
+        return snrt_l1alloc_aligned(size, MIN_CHUNK_SIZE);
+
+    uint32_t cls = l1_class(size);
+    if (alloc->free_small[cls]) {
+        uint32_t addr = alloc->free_small[cls];
+        alloc->free_small[cls] = heap_block(addr)->next;
+        return (void *)(addr + BLOCK_HDR);
+    }
+
+    return l1_alloc(alloc, MIN_CHUNK_SIZE << cls, MIN_CHUNK_SIZE, 0);
+}
+
+/**
+ * @brief Allocate an aligned chunk of memory in the L1 memory
+ * @details Aligning to `snrt_l1_bank_row()` makes the buffer start in the
+ * first TCDM bank.
+ *
+ * @param size number of bytes to allocate
+ * @param align alignment of the returned pointer, a power of two
+ * @return pointer to the allocated memory, 0 if the TCDM is exhausted
+ */
+void *snrt_l1alloc_aligned(size_t size, size_t align) {
+    struct snrt_l1_allocator *alloc = l1_allocator();
+
+    if (align < MIN_CHUNK_SIZE) align = MIN_CHUNK_SIZE;
+    size = heap_chunk_size(size);
+    if (!size) return 0;
+
+    return l1_alloc(alloc, size, align, 0);
+}
+
+/**
+ * @brief Allocate a chunk of memory in the L1 memory starting in a given TCDM
+ * bank
+ * @details Buffers that are streamed concurrently should start in different
+ * banks, otherwise their accesses hit the same bank in the same cycle. See
+ * `snrt_l1_bank_stagger` for a spread over several buffers.
+ *
+ * @param size number of bytes to allocate
+ * @param bank_offset bank of the first byte, modulo the number of banks
+ * @return pointer to the allocated memory, 0 if the TCDM is exhausted
+ */
+void *snrt_l1alloc_banked(size_t size, uint32_t bank_offset) {
+    struct snrt_l1_allocator *alloc = l1_allocator();
+
+    uint32_t row = snrt_l1_bank_row();
+    uint32_t offset = (bank_offset % SNRT_TCDM_BANK_NUM) * SNRT_TCDM_BANK_WIDTH;
+    size = heap_chunk_size(size);
+    if (!size) return 0;
+
+    return l1_alloc(alloc, size, row, offset);
+}
+
+/**
+ * @brief Bank offset of buffer `idx` out of `num` buffers that are accessed
+ * together, spreading their bases evenly over the TCDM banks
+ */
+uint32_t snrt_l1_bank_stagger(uint32_t idx, uint32_t num) {
+    return num ? idx * SNRT_TCDM_BANK_NUM / num : 0;
+}
+
+/**
+ * @brief Allocate a set of buffers that are accessed together, each starting
+ * in a different TCDM bank
+ *
+ * @param ptrs receives the `num` buffers
+ * @param sizes size of each buffer in bytes
+ * @param num number of buffers
+ * @return 0 on success, -1 if the TCDM is exhausted; nothing is allocated then
+ */
+int snrt_l1alloc_staggered(void **ptrs, const size_t *sizes, uint32_t num) {
+    for (uint32_t i = 0; i < num; i++) {
+        ptrs[i] = snrt_l1alloc_banked(sizes[i], snrt_l1_bank_stagger(i, num));
+        if (!ptrs[i]) {
+            while (i--) snrt_l1free(ptrs[i]);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Free a chunk of memory returned by the L1 allocator
+ *
+ * @param ptr pointer to the memory, may be 0
+ */
+void snrt_l1free(void *ptr) {
+    struct snrt_l1_allocator *alloc = l1_allocator();
+
+    if (!ptr) return;
+
+    uint32_t addr = (uint32_t)ptr - BLOCK_HDR;
+    struct heap_block *b = heap_block(addr);
+
+    if (heap_block_end(addr) == alloc->heap.next) {
+        alloc->heap.next = addr;
+        heap_trim_top(&alloc->heap);
+    } else if (l1_is_class_size(b->size)) {
+        uint32_t cls = l1_class(b->size);
+        b->next = alloc->free_small[cls];
+        alloc->free_small[cls] = addr;
+    } else {
+        heap_insert(&alloc->heap, addr);
+    }
+}
+
+/**
+ * @brief Checkpoint the L1 heap
+ * @details Everything allocated after the mark, from the top of the heap, is
+ * freed at once by `snrt_l1_release`.
+ *
+ * @return mark to pass to `snrt_l1_release`
+ */
+snrt_l1_mark_t snrt_l1_mark() { return l1_allocator()->heap.next; }
+
+/**
+ * @brief Free all memory allocated above a mark
+ * @details Blocks that were recycled from free memory below the mark are not
+ * affected and must still be freed individually. Marks must be released in
+ * reverse order.
+ *
+ * @param mark value returned by `snrt_l1_mark`
+ */
+void snrt_l1_release(snrt_l1_mark_t mark) {
+    struct snrt_l1_allocator *alloc = l1_allocator();
+
+    if (mark < alloc->heap.base) {
+        snrt_trace(SNRT_TRACE_ALLOC, "Invalid mark %#x: base %#x\n", mark,
+                   alloc->heap.base);
+        return;
+    }
+    // Already freed
+    if (mark >= alloc->heap.next) return;
+
+    alloc->heap.next = mark;
+
+    // Forget free blocks above the mark
+    for (uint32_t cls = 0; cls < SNRT_L1_NR_CLASSES; cls++) {
+        uint32_t *link = &alloc->free_small[cls];
+        while (*link) {
+            if (*link >= mark)
+                *link = heap_block(*link)->next;
+            else
+                link = &heap_block(*link)->next;
+        }
+    }
+    uint32_t *link = &alloc->heap.free;
+    while (*link && *link < mark) {
+        uint32_t addr = *link;
+        if (heap_block_end(addr) > mark)
+            heap_block(addr)->size = mark - addr - BLOCK_HDR;
+        link = &heap_block(addr)->next;
+    }
+    *link = 0;
+    heap_trim_top(&alloc->heap);
+}
+
+/**
+ * @brief Number of interleaved TCDM banks
+ */
+uint32_t snrt_l1_bank_num() { return SNRT_TCDM_BANK_NUM; }
+
+/**
+ * @brief Size of one row of TCDM banks in bytes
+ * @details Addresses that are a multiple of it map to the first bank.
+ */
+uint32_t snrt_l1_bank_row() {
+    return SNRT_TCDM_BANK_NUM * SNRT_TCDM_BANK_WIDTH;
+}
+
+//================================================================================
+// L3 heap
+//================================================================================
+//
+// All clusters allocate from the same DRAM range, so there is a single heap
+// whose state and lock live in DRAM as well. The first hart to boot sets it
+// up; everyone else waits until it is ready.
+
+enum { L3_HEAP_UNINIT, L3_HEAP_INIT, L3_HEAP_READY };
+
+static struct snrt_l3_allocator l3_allocator __attribute__((section(".dram")));
+static volatile uint32_t l3_heap_state __attribute__((section(".dram")));
+
 /**
  * @brief Allocate a chunk of memory in the L3 memory
- * @details This currently does not support free-ing of memory
+ * @details Allocations are 8-byte aligned and safe to make from any hart of
+ * any cluster.
  *
  * @param size number of bytes to allocate
- * @return pointer to the allocated memory
+ * @return pointer to the allocated memory, 0 if the DRAM is exhausted
  */
 void *snrt_l3alloc(size_t size) {
-    struct snrt_allocator_inst *alloc = &snrt_current_team()->allocator.l3;
+    struct snrt_l3_allocator *alloc = &l3_allocator;
+
+    size = heap_chunk_size(size);
+    if (!size) return 0;
 
-    // TODO: L3 alloc size check
+    snrt_mutex_ttas_lock(&alloc->lock);
+    void *ret = heap_alloc_fit(&alloc->heap, size, MIN_CHUNK_SIZE, 0);
+    if (!ret) ret = heap_alloc_top(&alloc->heap, size, MIN_CHUNK_SIZE, 0);
+    snrt_mutex_release(&alloc->lock);
 
-    void *ret = (void *)alloc->next;
-    alloc->next += size;
     return ret;
 }
 
+/**
+ * @brief Free a chunk of memory returned by `snrt_l3alloc`
+ *
+ * @param ptr pointer to the memory, may be 0
+ */
+void snrt_l3free(void *ptr) {
+    struct snrt_l3_allocator *alloc = &l3_allocator;
+
+    if (!ptr) return;
+
+    uint32_t addr = (uint32_t)ptr - BLOCK_HDR;
+
+    snrt_mutex_ttas_lock(&alloc->lock);
+    if (heap_block_end(addr) == alloc->heap.next) {
+        alloc->heap.next = addr;
+        heap_trim_top(&alloc->heap);
+    } else {
+        heap_insert(&alloc->heap, addr);
+    }
+    snrt_mutex_release(&alloc->lock);
+}
+
 /**
  * @brief Init the allocator
- * @details
+ * @details Called by every hart. The L1 heap belongs to the cluster, the L3
+ * heap is set up once for all clusters.
  *
  * @param snrt_team_root pointer to the team structure
  * @param l3off Number of bytes to skip on _edram before starting allocator
  */
 void snrt_alloc_init(struct snrt_team_root *team, uint32_t l3off) {
     // Allocator in L1 TCDM memory
-    team->allocator.l1.base =
+    team->allocator.l1.heap.base =
         ALIGN_UP((uint32_t)team->cluster_mem.start, MIN_CHUNK_SIZE);
-    team->allocator.l1.size =
+    team->allocator.l1.heap.size =
         (uint32_t)(team->cluster_mem.end - team->cluster_mem.start);
-    team->allocator.l1.next = team->allocator.l1.base;
-    // Allocator in L3 shared memory
+    team->allocator.l1.heap.next = team->allocator.l1.heap.base;
+    team->allocator.l1.heap.free = 0;
+    for (uint32_t cls = 0; cls < SNRT_L1_NR_CLASSES; cls++)
+        team->allocator.l1.free_small[cls] = 0;
+    // Allocator in L3 shared memory, up to the end of the DRAM region
     extern uint32_t _edram;
-    team->allocator.l3.base =
-        ALIGN_UP((uint32_t)_edram + l3off, MIN_CHUNK_SIZE);
-    ;
-    team->allocator.l3.size = 0;
-    team->allocator.l3.next = team->allocator.l3.base;
+    extern uint32_t __dram_start;
+    extern uint32_t __dram_size;
+    struct snrt_l3_allocator *l3 = &l3_allocator;
+    uint32_t l3_base = ALIGN_UP((uint32_t)&_edram + l3off, MIN_CHUNK_SIZE);
+    // The DRAM may reach up to 4 GiB, whose end address does not fit 32 bits.
+    // The heap stops one chunk short of it then, so that its end never wraps.
+    uint64_t dram_end =
+        (uint64_t)(uint32_t)&__dram_start + (uint32_t)&__dram_size;
+    uint32_t l3_end = dram_end > UINT32_MAX
+                          ? ALIGN_DOWN(UINT32_MAX, MIN_CHUNK_SIZE)
+                          : (uint32_t)dram_end;
+    uint32_t state = L3_HEAP_UNINIT;
+    if (__atomic_compare_exchange_n(&l3_heap_state, &state, L3_HEAP_INIT, 0,
+                                    __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE)) {
+        l3->heap.base = l3_base;
+        l3->heap.size = l3_end - l3_base;
+        l3->heap.next = l3_base;
+        l3->heap.free = 0;
+        l3->lock = 0;
+        __atomic_store_n(&l3_heap_state, L3_HEAP_READY, __ATOMIC_RELEASE);
+        return;
+    }
+    while (__atomic_load_n(&l3_heap_state, __ATOMIC_ACQUIRE) != L3_HEAP_READY)
+        ;
+    // A cluster with higher hart ids reserves more putc buffers below the
+    // heap. Move the base up while the heap is still empty.
+    snrt_mutex_ttas_lock(&l3->lock);
+    if (l3_base > l3->heap.base) {
+        if (l3->heap.next == l3->heap.base && !l3->heap.free) {
+            l3->heap.size -= l3_base - l3->heap.base;
+            l3->heap.base = l3_base;
+            l3->heap.next = l3_base;
+        } else {
+            snrt_trace(SNRT_TRACE_ALLOC,
+                       "L3 heap at %#x overlaps the putc buffers up to %#x\n",
+                       l3->heap.base, l3_base);
+        }
+    }
+    snrt_mutex_release(&l3->lock);
 }
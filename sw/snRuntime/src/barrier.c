@@ -1,6 +1,7 @@
 // Copyright 2020 ETH Zurich and University of Bologna.
 // Licensed under the Apache License, Version 2.0, see LICENSE for details.
 // SPDX-License-Identifier: Apache-2.0
+#include "debug.h"
 #include "snrt.h"
 #include "team.h"
 
@@ -9,68 +10,245 @@ extern void _snrt_cluster_barrier();
 /// Synchronize cores in a cluster with a hardware barrier
 void snrt_cluster_hw_barrier() { _snrt_cluster_barrier(); }
 
-/// Synchronize cores in a cluster with a software barrier
-void snrt_cluster_sw_barrier() {
-    // Remember previous iteration
-    volatile struct snrt_barrier *barrier_ptr =
-        &_snrt_team_current->root->cluster_barrier;
-    uint32_t prev_barrier_iteration = barrier_ptr->barrier_iteration;
-    uint32_t barrier =
-        __atomic_add_fetch(&barrier_ptr->barrier, 1, __ATOMIC_RELAXED);
+//================================================================================
+// Sleeping waits
+//================================================================================
 
-    // Increment the barrier counter
-    if (barrier == snrt_cluster_core_num()) {
-        barrier_ptr->barrier = 0;
-        __atomic_add_fetch(&barrier_ptr->barrier_iteration, 1,
-                           __ATOMIC_RELAXED);
-    } else {
-        // Some threads have not reached the barrier --> Let's wait
-        while (prev_barrier_iteration == barrier_ptr->barrier_iteration)
-            ;
+// A waiting core polls at least SNRT_SLEEP_SPIN_MIN and at most
+// SNRT_SLEEP_SPIN_MAX times before it sleeps in wfi. The budget doubles after
+// a wait that ended while polling and halves after one that had to sleep.
+#ifndef SNRT_SLEEP_SPIN_MIN
+#define SNRT_SLEEP_SPIN_MIN 16
+#endif
+#ifndef SNRT_SLEEP_SPIN_MAX
+#define SNRT_SLEEP_SPIN_MAX 1024
+#endif
+
+static __thread uint32_t spin_budget = SNRT_SLEEP_SPIN_MIN;
+
+static inline void spin_hit() {
+    if (spin_budget < SNRT_SLEEP_SPIN_MAX) spin_budget <<= 1;
+}
+
+static inline void spin_miss() {
+    if (spin_budget > SNRT_SLEEP_SPIN_MIN) spin_budget >>= 1;
+}
+
+/**
+ * @brief Announce the calling core in `sleepers` and sleep until `done`
+ * returns non-zero
+ * @details A waker clears the bits it wakes from `sleepers` before raising
+ * their cluster interrupt, and a sleeper checks `done` after announcing
+ * itself, so no wakeup is lost. A sleeper whose bit was taken by a waker
+ * consumes that interrupt before it leaves, so that it cannot cut short a
+ * later wfi of the event unit or the data mover. Relies on interrupts not being
+ * globally enabled, as everywhere else in the runtime. The cluster interrupt
+ * is left enabled only if it was before.
+ *
+ * Sleepers are cluster cores woken through the cluster CLINT, so all cores
+ * sharing `sleepers` must belong to the same cluster.
+ */
+static void sleep_until(int (*done)(volatile void *), volatile void *arg,
+                        volatile uint32_t *sleepers) {
+    uint32_t bit = 1 << snrt_cluster_core_idx();
+    uint32_t irq_enabled = read_csr(mie) & (1 << IRQ_M_CLUSTER);
+
+    if (!irq_enabled) snrt_interrupt_enable(IRQ_M_CLUSTER);
+    while (1) {
+        __atomic_fetch_or(sleepers, bit, __ATOMIC_RELAXED);
+        if (done(arg)) break;
+        snrt_wfi();
+        snrt_int_cluster_clr(bit);
+    }
+    if (!(__atomic_fetch_and(sleepers, ~bit, __ATOMIC_RELAXED) & bit)) {
+        snrt_wfi();
+        snrt_int_cluster_clr(bit);
     }
+    if (!irq_enabled) snrt_interrupt_disable(IRQ_M_CLUSTER);
 }
 
-static volatile struct snrt_barrier global_barrier
-    __attribute__((section(".dram")));
+/// Wake all cores sleeping on `sleepers`
+static inline void wake_all(volatile uint32_t *sleepers) {
+    if (!__atomic_load_n(sleepers, __ATOMIC_RELAXED)) return;
+    uint32_t mask = __atomic_exchange_n(sleepers, 0, __ATOMIC_RELAXED);
+    if (mask) snrt_int_cluster_set(mask);
+}
 
-/// Synchronize clusters globally with a global software barrier
-void snrt_global_barrier() {
+/// Wake one of the cores sleeping on `sleepers`
+static inline void wake_one(volatile uint32_t *sleepers) {
+    uint32_t mask;
+    while ((mask = __atomic_load_n(sleepers, __ATOMIC_RELAXED))) {
+        uint32_t bit = mask & -mask;
+        if (__atomic_fetch_and(sleepers, ~bit, __ATOMIC_RELAXED) & bit) {
+            snrt_int_cluster_set(bit);
+            return;
+        }
+    }
+}
+
+//================================================================================
+// Barriers
+//================================================================================
+
+struct barrier_wait {
+    volatile struct snrt_barrier *barr;
+    uint32_t prev_it;
+};
+
+static int barrier_passed(volatile void *arg) {
+    volatile struct barrier_wait *w = arg;
+    return __atomic_load_n(&w->barr->barrier_iteration, __ATOMIC_ACQUIRE) !=
+           w->prev_it;
+}
+
+static void barrier_wait(struct snrt_barrier *barr, uint32_t n, int sleep) {
     // Remember previous iteration
-    volatile struct snrt_barrier *barrier_ptr = &global_barrier;
-    uint32_t prev_barrier_iteration = barrier_ptr->barrier_iteration;
-    uint32_t barrier =
-        __atomic_add_fetch(&barrier_ptr->barrier, 1, __ATOMIC_RELAXED);
+    struct barrier_wait w = {barr, barr->barrier_iteration};
+    uint32_t barrier = __atomic_add_fetch(&barr->barrier, 1, __ATOMIC_RELAXED);
 
     // Increment the barrier counter
-    if (barrier == snrt_global_core_num()) {
-        barrier_ptr->barrier = 0;
-        __atomic_add_fetch(&barrier_ptr->barrier_iteration, 1,
-                           __ATOMIC_RELAXED);
-    } else {
-        // Some threads have not reached the barrier --> Let's wait
-        while (prev_barrier_iteration == barrier_ptr->barrier_iteration)
+    if (barrier == n) {
+        barr->barrier = 0;
+        __atomic_add_fetch(&barr->barrier_iteration, 1, __ATOMIC_RELEASE);
+        if (sleep) wake_all(&barr->sleepers);
+        return;
+    }
+
+    // Some threads have not reached the barrier --> Let's wait
+    if (!sleep) {
+        while (!barrier_passed(&w))
             ;
+        return;
     }
+    for (uint32_t i = 0; i < spin_budget; i++) {
+        if (barrier_passed(&w)) {
+            spin_hit();
+            return;
+        }
+    }
+    spin_miss();
+    sleep_until(barrier_passed, &w, &barr->sleepers);
 }
 
 /**
  * @brief Generic barrier
+ * @details Waiting cores poll the counter, so the harts can belong to any
+ * cluster.
  *
  * @param barr pointer to a barrier
  * @param n number of harts that have to enter before released
  */
 void snrt_barrier(struct snrt_barrier *barr, uint32_t n) {
-    // Remember previous iteration
-    uint32_t prev_it = barr->barrier_iteration;
-    uint32_t barrier = __atomic_add_fetch(&barr->barrier, 1, __ATOMIC_RELAXED);
+    barrier_wait(barr, n, 0);
+}
 
-    // Increment the barrier counter
-    if (barrier == n) {
-        barr->barrier = 0;
-        __atomic_add_fetch(&barr->barrier_iteration, 1, __ATOMIC_RELAXED);
-    } else {
-        // Some threads have not reached the barrier --> Let's wait
-        while (prev_it == barr->barrier_iteration)
+/**
+ * @brief Barrier between cores of one cluster
+ * @details Waiting cores poll briefly and then sleep until the last core
+ * arrives, instead of loading the counter from the TCDM until then. They are
+ * woken through the cluster CLINT, so all `n` cores must belong to the
+ * calling cluster.
+ *
+ * @param barr pointer to a barrier
+ * @param n number of cores that have to enter before released
+ */
+void snrt_sleep_barrier(struct snrt_barrier *barr, uint32_t n) {
+    barrier_wait(barr, n, 1);
+}
+
+/// Synchronize cores in a cluster with a software barrier
+void snrt_cluster_sw_barrier() {
+    snrt_sleep_barrier(&_snrt_team_current->root->cluster_barrier,
+                       snrt_cluster_core_num());
+}
+
+// Number of clusters supported by snrt_global_barrier, and the rounds of the
+// dissemination barrier it needs for them, ceil(log2(max clusters)) but at
+// least one
+#ifndef SNRT_BARRIER_MAX_CLUSTERS
+#define SNRT_BARRIER_MAX_CLUSTERS 32
+#endif
+_Static_assert(SNRT_BARRIER_MAX_CLUSTERS >= 1,
+               "SNRT_BARRIER_MAX_CLUSTERS must be at least 1");
+#define SNRT_BARRIER_MAX_ROUNDS \
+    (32 - __builtin_clz((SNRT_BARRIER_MAX_CLUSTERS - 1) | 1))
+
+// Dissemination barrier between the clusters. In round `r` cluster `i`
+// signals cluster `(i + 2^r) % n` and waits for the signal of cluster
+// `(i - 2^r) % n`. Every flag has a single writer, which stores the number of
+// the barrier episode, so the flags never need to be reset.
+static volatile uint32_t
+    global_barrier_flags[SNRT_BARRIER_MAX_ROUNDS][SNRT_BARRIER_MAX_CLUSTERS]
+    __attribute__((section(".dram")));
+
+// Episodes completed by this cluster, only used by its core 0
+static __thread uint32_t global_barrier_episode;
+
+static void cluster_dissemination_barrier(uint32_t cluster_idx,
+                                          uint32_t cluster_num) {
+    uint32_t episode = ++global_barrier_episode;
+    for (uint32_t r = 0, dist = 1; dist < cluster_num; r++, dist <<= 1) {
+        uint32_t partner = (cluster_idx + dist) % cluster_num;
+        __atomic_store_n(&global_barrier_flags[r][partner], episode,
+                         __ATOMIC_RELEASE);
+        // Flags only grow, a partner already in the next episode also counts
+        while ((int32_t)(__atomic_load_n(&global_barrier_flags[r][cluster_idx],
+                                         __ATOMIC_ACQUIRE) -
+                         episode) < 0)
             ;
     }
 }
+
+/// Synchronize clusters globally with a hierarchical barrier. The cores of a
+/// cluster meet at the cluster's hardware barrier, where they stay clock-gated
+/// while core 0 of every cluster synchronizes with the other clusters through
+/// flags in DRAM; a second hardware barrier releases the cluster. With more
+/// than SNRT_BARRIER_MAX_CLUSTERS clusters, the call traces an error and only
+/// synchronizes the cluster.
+void snrt_global_barrier() {
+    uint32_t cluster_num = snrt_cluster_num();
+
+    snrt_cluster_hw_barrier();
+    if (cluster_num <= 1) return;
+
+    if (snrt_cluster_core_idx() == 0) {
+        if (cluster_num <= SNRT_BARRIER_MAX_CLUSTERS)
+            cluster_dissemination_barrier(snrt_cluster_idx(), cluster_num);
+        else
+            snrt_trace(SNRT_TRACE_INIT,
+                       "Global barrier over %u clusters, max %d\n",
+                       cluster_num, SNRT_BARRIER_MAX_CLUSTERS);
+    }
+    snrt_cluster_hw_barrier();
+}
+
+//================================================================================
+// Mutex
+//================================================================================
+
+static int mutex_acquired(volatile void *arg) {
+    volatile snrt_sleep_mutex_t *m = arg;
+    return !__atomic_exchange_n(&m->lock, 1, __ATOMIC_ACQUIRE);
+}
+
+/**
+ * @brief Lock a mutex, polling briefly and then sleeping until it is released
+ */
+void snrt_sleep_mutex_lock(snrt_sleep_mutex_t *m) {
+    for (uint32_t i = 0; i < spin_budget; i++) {
+        if (!m->lock && mutex_acquired(m)) {
+            spin_hit();
+            return;
+        }
+    }
+    spin_miss();
+    sleep_until(mutex_acquired, m, &m->sleepers);
+}
+
+/**
+ * @brief Release a mutex and wake one of the cores sleeping on it
+ */
+void snrt_sleep_mutex_release(snrt_sleep_mutex_t *m) {
+    __atomic_store_n(&m->lock, 0, __ATOMIC_RELEASE);
+    wake_one(&m->sleepers);
+}
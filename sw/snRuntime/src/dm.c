@@ -22,10 +22,15 @@
 
 /**
  * @brief Number of outstanding transactions to buffer. Each requires
- * sizeof(dm_task_t) bytes
+ * sizeof(dm_slot_t) bytes. Must be a power of two.
  *
  */
-#define DM_TASK_QUEUE_SIZE 4
+#ifndef DM_TASK_QUEUE_SIZE
+#define DM_TASK_QUEUE_SIZE 16
+#endif
+
+_Static_assert((DM_TASK_QUEUE_SIZE & (DM_TASK_QUEUE_SIZE - 1)) == 0,
+               "DM_TASK_QUEUE_SIZE must be a power of two");
 
 //================================================================================
 // Macros
@@ -56,6 +61,14 @@ typedef struct {
     uint32_t twod;
 } dm_task_t;
 
+// Queue entry. The producer that claimed position `pos` may fill the entry
+// once `seq == pos` and publishes it with `seq = pos + 1`; the DM core hands
+// it to the producer one lap later with `seq = pos + DM_TASK_QUEUE_SIZE`.
+typedef struct {
+    dm_task_t task;
+    volatile uint32_t seq;
+} dm_slot_t;
+
 // used for ultra-fine grained communication
 // stat_q can be used to request a command, 0 is no command
 // the response is put into stat_p and is valid iff stat_pvalid is non-zero
@@ -69,10 +82,12 @@ typedef enum en_stat {
 } en_stat_t;
 
 typedef struct {
-    dm_task_t queue[DM_TASK_QUEUE_SIZE];
-    uint32_t queue_back;
-    uint32_t queue_front;
-    volatile uint32_t queue_fill;
+    dm_slot_t queue[DM_TASK_QUEUE_SIZE];
+    // next position to issue, only written by the DM core
+    volatile uint32_t queue_back;
+    // next position to claim, bumped by the producers with an AMO
+    volatile uint32_t queue_front;
+    // serializes the stat requests
     volatile uint32_t mutex;
     volatile en_stat_t stat_q;
     volatile uint32_t stat_p;
@@ -106,6 +121,10 @@ __thread uint32_t cluster_dm_core_idx;
 //================================================================================
 static void wfi_dm(uint32_t cluster_core_idx);
 static void wake_dm(void);
+static volatile dm_task_t *dm_claim(void);
+static void dm_publish(volatile dm_task_t *t);
+static int dm_ready(uint32_t pos);
+static void dm_issue(void);
 
 //================================================================================
 // Debug
@@ -140,6 +159,8 @@ void dm_init(void) {
 #endif
         dm_p = (dm_t *)snrt_l1alloc(sizeof(dm_t));
         snrt_memset((void *)dm_p, 0, sizeof(dm_t));
+        for (uint32_t i = 0; i < DM_TASK_QUEUE_SIZE; i++)
+            dm_p->queue[i].seq = i;
         dm_p_global = dm_p;
     } else {
         while (!dm_p_global)
@@ -149,7 +170,6 @@ void dm_init(void) {
 }
 
 void dm_main(void) {
-    volatile dm_task_t *t;
     uint32_t do_exit = 0;
     uint32_t cluster_core_idx = snrt_cluster_core_idx();
 
@@ -157,26 +177,7 @@ void dm_main(void) {
 
     while (!do_exit) {
         /// New transaction to issue?
-        if (dm_p->queue_fill) {
-            // wait until DMA is ready
-            while (__builtin_sdma_stat(DM_STATUS_WOULD_BLOCK))
-                ;
-
-            t = &dm_p->queue[dm_p->queue_back];
-
-            if (t->twod) {
-                DM_PRINTF(10, "start twod\n");
-                __builtin_sdma_start_twod(t->src, t->dst, t->size, t->sstrd,
-                                          t->dstrd, t->nreps, t->cfg);
-            } else {
-                DM_PRINTF(10, "start oned\n");
-                __builtin_sdma_start_oned(t->src, t->dst, t->size, t->cfg);
-            }
-
-            // bump
-            dm_p->queue_back = (dm_p->queue_back + 1) % DM_TASK_QUEUE_SIZE;
-            __atomic_add_fetch(&dm_p->queue_fill, -1, __ATOMIC_RELAXED);
-        }
+        if (dm_ready(dm_p->queue_back)) dm_issue();
 
         /// any STAT request pending?
         if (dm_p->stat_q) {
@@ -202,7 +203,7 @@ void dm_main(void) {
         }
 
         // sleep if queue is empty and no stats pending
-        if (!dm_p->queue_fill && !dm_p->stat_q) {
+        if (!dm_ready(dm_p->queue_back) && !dm_p->stat_q) {
             wfi_dm(cluster_core_idx);
         }
     }
@@ -216,50 +217,29 @@ void dm_main(void) {
 }
 
 void dm_memcpy_async(void *dest, const void *src, size_t n) {
-    uint32_t s;
     volatile dm_task_t *t;
 
     DM_PRINTF(10, "dm_memcpy_async %#x -> %#x size %d\n", src, dest,
               (uint32_t)n);
 
-    // poll queue size
-    do {
-        s = __atomic_load_n(&dm_p->queue_fill, __ATOMIC_RELAXED);
-    } while (s >= DM_TASK_QUEUE_SIZE);
-    _dm_mtx_lock();
-
-    // insert
-    t = &dm_p->queue[dm_p->queue_front];
+    t = dm_claim();
     t->src = (uint64_t)src;
     t->dst = (uint64_t)dest;
     t->size = (uint32_t)n;
     t->twod = 0;
     t->cfg = 0;
-
-    // bump
-    __atomic_add_fetch(&dm_p->queue_fill, 1, __ATOMIC_RELAXED);
-    dm_p->queue_front = (dm_p->queue_front + 1) % DM_TASK_QUEUE_SIZE;
-
-    _dm_mtx_release();
+    dm_publish(t);
 }
 
 void dm_memcpy2d_async(uint64_t src, uint64_t dst, uint32_t size,
                        uint32_t sstrd, uint32_t dstrd, uint32_t nreps,
                        uint32_t cfg) {
-    uint32_t s;
     volatile dm_task_t *t;
 
     DM_PRINTF(10, "dm_memcpy2d_async %#x -> %#x size %d\n", src, dst,
               (uint32_t)size);
 
-    // poll queue size
-    do {
-        s = __atomic_load_n(&dm_p->queue_fill, __ATOMIC_RELAXED);
-    } while (s >= DM_TASK_QUEUE_SIZE);
-    _dm_mtx_lock();
-
-    // insert
-    t = &dm_p->queue[dm_p->queue_front];
+    t = dm_claim();
     t->src = src;
     t->dst = dst;
     t->size = size;
@@ -268,12 +248,7 @@ void dm_memcpy2d_async(uint64_t src, uint64_t dst, uint32_t size,
     t->nreps = nreps;
     t->twod = 1;
     t->cfg = cfg;
-
-    // bump
-    __atomic_add_fetch(&dm_p->queue_fill, 1, __ATOMIC_RELAXED);
-    dm_p->queue_front = (dm_p->queue_front + 1) % DM_TASK_QUEUE_SIZE;
-
-    _dm_mtx_release();
+    dm_publish(t);
 }
 
 void dm_start(void) { wake_dm(); }
@@ -286,8 +261,8 @@ void dm_wait(void) {
 
     // first, wait for the dm queue to be empty and no request be pending
     do {
-        s = __atomic_load_n(&dm_p->queue_fill, __ATOMIC_RELAXED);
-    } while (s != 0);
+        s = __atomic_load_n(&dm_p->queue_front, __ATOMIC_RELAXED);
+    } while (s != dm_p->queue_back);
     while (dm_p->stat_q)
         ;
 
@@ -325,6 +300,84 @@ void dm_wait_ready(void) {
 // private
 //================================================================================
 
+/**
+ * @brief Claim the next queue position and wait for its entry to be free
+ * @details The position is taken with a single AMO, so producers never wait
+ * for each other, only for the DM core if the queue is full.
+ */
+static volatile dm_task_t *dm_claim(void) {
+    uint32_t pos = __atomic_fetch_add(&dm_p->queue_front, 1, __ATOMIC_RELAXED);
+    volatile dm_slot_t *e = &dm_p->queue[pos % DM_TASK_QUEUE_SIZE];
+    while (__atomic_load_n(&e->seq, __ATOMIC_ACQUIRE) != pos)
+        ;
+    return &e->task;
+}
+
+static void dm_publish(volatile dm_task_t *t) {
+    volatile dm_slot_t *e = (volatile dm_slot_t *)t;
+    __atomic_store_n(&e->seq, e->seq + 1, __ATOMIC_RELEASE);
+}
+
+static int dm_ready(uint32_t pos) {
+    volatile dm_slot_t *e = &dm_p->queue[pos % DM_TASK_QUEUE_SIZE];
+    return __atomic_load_n(&e->seq, __ATOMIC_ACQUIRE) == pos + 1;
+}
+
+/**
+ * @brief Issue the task at the back of the queue, merged with the ready tasks
+ * behind it that continue it as rows of a 2D transfer: 1D copies of the same
+ * size and DMA configuration whose source and destination advance by constant
+ * strides.
+ */
+static void dm_issue(void) {
+    uint32_t pos = dm_p->queue_back;
+    volatile dm_slot_t *e = &dm_p->queue[pos % DM_TASK_QUEUE_SIZE];
+    dm_task_t t = e->task;
+
+    if (!t.twod) {
+        t.nreps = 1;
+        t.cfg = 0;
+    }
+    __atomic_store_n(&e->seq, pos + DM_TASK_QUEUE_SIZE, __ATOMIC_RELEASE);
+    pos++;
+
+    while (dm_ready(pos)) {
+        e = &dm_p->queue[pos % DM_TASK_QUEUE_SIZE];
+        if (e->task.twod || e->task.size != t.size || e->task.cfg != t.cfg)
+            break;
+        uint64_t src = e->task.src;
+        uint64_t dst = e->task.dst;
+        if (t.nreps == 1) {
+            // the second row fixes the strides
+            if (src < t.src || src - t.src > UINT32_MAX || dst < t.dst ||
+                dst - t.dst > UINT32_MAX)
+                break;
+            t.sstrd = src - t.src;
+            t.dstrd = dst - t.dst;
+        } else if (src != t.src + (uint64_t)t.sstrd * t.nreps ||
+                   dst != t.dst + (uint64_t)t.dstrd * t.nreps) {
+            break;
+        }
+        t.nreps++;
+        __atomic_store_n(&e->seq, pos + DM_TASK_QUEUE_SIZE, __ATOMIC_RELEASE);
+        pos++;
+    }
+    dm_p->queue_back = pos;
+
+    // wait until DMA is ready
+    while (__builtin_sdma_stat(DM_STATUS_WOULD_BLOCK))
+        ;
+
+    if (t.nreps > 1) {
+        DM_PRINTF(10, "start twod, %d rows\n", t.nreps);
+        __builtin_sdma_start_twod(t.src, t.dst, t.size, t.sstrd, t.dstrd,
+                                  t.nreps, t.cfg);
+    } else {
+        DM_PRINTF(10, "start oned\n");
+        __builtin_sdma_start_oned(t.src, t.dst, t.size, t.cfg);
+    }
+}
+
 #ifdef DM_USE_GLOBAL_CLINT
 static void wfi_dm(uint32_t cluster_core_idx) {
     (void)cluster_core_idx;
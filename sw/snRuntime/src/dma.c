@@ -3,6 +3,8 @@
 // SPDX-License-Identifier: Apache-2.0
 #include <snrt.h>
 
+#include "debug.h"
+
 /// Initiate an asynchronous 1D DMA transfer with wide 64-bit pointers.
 snrt_dma_txid_t snrt_dma_start_1d_wideptr(uint64_t dst, uint64_t src,
                                           size_t size) {
@@ -123,6 +125,142 @@ snrt_dma_txid_t snrt_dma_start_2d(void *dst, const void *src, size_t size,
                                      src_stride, repeat);
 }
 
+/// Initiate an asynchronous N-dimensional DMA transfer with wide 64-bit
+/// pointers. Dimension 0 is `size` contiguous bytes; dimension `d` > 0 repeats
+/// dimension `d - 1` `repeats[d - 1]` times, `dst_strides[d - 1]` and
+/// `src_strides[d - 1]` bytes apart. Repeats must be non-zero.
+///
+/// Dimensions that continue the one below contiguously are merged. The first
+/// remaining outer dimension is handled by the 2D engine, all further ones are
+/// issued as a sequence of 2D transfers. The DMA keeps the strides and repeats
+/// across transfers, so every further 2D plane only needs new addresses.
+/// Returns the ID of the last transfer, which completes after all others, or
+/// SNRT_DMA_TXID_INVALID if `ndims` exceeds SNRT_DMA_MAX_DIMS.
+snrt_dma_txid_t snrt_dma_start_nd_wideptr(uint64_t dst, uint64_t src,
+                                          size_t size,
+                                          const size_t *dst_strides,
+                                          const size_t *src_strides,
+                                          const size_t *repeats,
+                                          uint32_t ndims) {
+    size_t dstrd[SNRT_DMA_MAX_DIMS - 1];
+    size_t sstrd[SNRT_DMA_MAX_DIMS - 1];
+    size_t rep[SNRT_DMA_MAX_DIMS - 1];
+    uint32_t n = 0;
+
+    if (ndims > SNRT_DMA_MAX_DIMS) {
+        snrt_trace(SNRT_TRACE_DMA, "DMA transfer has %u dimensions, max %d\n",
+                   ndims, SNRT_DMA_MAX_DIMS);
+        return SNRT_DMA_TXID_INVALID;
+    }
+
+    for (uint32_t d = 0; d + 1 < ndims; d++) {
+        if (repeats[d] == 1) continue;
+        if (n == 0 && dst_strides[d] == size && src_strides[d] == size) {
+            size *= repeats[d];
+        } else if (n > 0 && dst_strides[d] == dstrd[n - 1] * rep[n - 1] &&
+                   src_strides[d] == sstrd[n - 1] * rep[n - 1]) {
+            rep[n - 1] *= repeats[d];
+        } else {
+            dstrd[n] = dst_strides[d];
+            sstrd[n] = src_strides[d];
+            rep[n] = repeats[d];
+            n++;
+        }
+    }
+
+    if (n == 0) return snrt_dma_start_1d_wideptr(dst, src, size);
+    if (n == 1)
+        return snrt_dma_start_2d_wideptr(dst, src, size, dstrd[0], sstrd[0],
+                                         rep[0]);
+
+    register uint32_t reg_dst_stride asm("a5") = dstrd[0];  // 15
+    register uint32_t reg_src_stride asm("a6") = sstrd[0];  // 16
+    register uint32_t reg_repeat asm("a7") = rep[0];        // 17
+
+    // dmstr a5, a6
+    asm volatile(
+        ".word (0b0000110 << 25) | \
+               (     (15) << 20) | \
+               (     (16) << 15) | \
+               (    0b000 << 12) | \
+               (0b0101011 <<  0)   \n"
+        :
+        : "r"(reg_dst_stride), "r"(reg_src_stride));
+
+    // dmrep a7
+    asm volatile(
+        ".word (0b0000111 << 25) | \
+               (     (17) << 15) | \
+               (    0b000 << 12) | \
+               (0b0101011 <<  0)   \n"
+        :
+        : "r"(reg_repeat));
+
+    uint32_t idx[SNRT_DMA_MAX_DIMS - 1] = {0};
+    snrt_dma_txid_t txid;
+    uint32_t d;
+
+    do {
+        register uint32_t reg_dst_low asm("a0") = dst >> 0;    // 10
+        register uint32_t reg_dst_high asm("a1") = dst >> 32;  // 11
+        register uint32_t reg_src_low asm("a2") = src >> 0;    // 12
+        register uint32_t reg_src_high asm("a3") = src >> 32;  // 13
+        register uint32_t reg_size asm("a4") = size;           // 14
+
+        // dmsrc a0, a1
+        asm volatile(
+            ".word (0b0000000 << 25) | \
+                   (     (13) << 20) | \
+                   (     (12) << 15) | \
+                   (    0b000 << 12) | \
+                   (0b0101011 <<  0)   \n" ::"r"(reg_src_high),
+            "r"(reg_src_low));
+
+        // dmdst a0, a1
+        asm volatile(
+            ".word (0b0000001 << 25) | \
+                   (     (11) << 20) | \
+                   (     (10) << 15) | \
+                   (    0b000 << 12) | \
+                   (0b0101011 <<  0)   \n" ::"r"(reg_dst_high),
+            "r"(reg_dst_low));
+
+        // dmcpyi a0, a4, 0b10
+        register uint32_t reg_txid asm("a0");  // 10
+        asm volatile(
+            ".word (0b0000010 << 25) | \
+                   (  0b00010 << 20) | \
+                   (     (14) << 15) | \
+                   (    0b000 << 12) | \
+                   (     (10) <<  7) | \
+                   (0b0101011 <<  0)   \n"
+            : "=r"(reg_txid)
+            : "r"(reg_size));
+        txid = reg_txid;
+
+        // Advance to the next plane, odometer-style over the outer dimensions
+        for (d = 1; d < n; d++) {
+            dst += dstrd[d];
+            src += sstrd[d];
+            if (++idx[d] < rep[d]) break;
+            dst -= (uint64_t)dstrd[d] * rep[d];
+            src -= (uint64_t)sstrd[d] * rep[d];
+            idx[d] = 0;
+        }
+    } while (d < n);
+
+    return txid;
+}
+
+/// Initiate an asynchronous N-dimensional DMA transfer.
+snrt_dma_txid_t snrt_dma_start_nd(void *dst, const void *src, size_t size,
+                                  const size_t *dst_strides,
+                                  const size_t *src_strides,
+                                  const size_t *repeats, uint32_t ndims) {
+    return snrt_dma_start_nd_wideptr((size_t)dst, (size_t)src, size,
+                                     dst_strides, src_strides, repeats, ndims);
+}
+
 /// Block until a transfer finishes.
 void snrt_dma_wait(snrt_dma_txid_t tid) {
     // dmstati t0, 0  # 2=status.completed_id
@@ -151,3 +289,17 @@ void snrt_dma_wait_all() {
         "bne t0, zero, 1b \n" ::
             : "t0");
 }
+
+/// Initiate an asynchronous transfer of DIMC kernel sections from memory.
+/// The kernel memory window assigns 32 KiB to each core, 4 KiB to each macro
+/// and 128 B to each row; consecutive sections fill up a row before moving on
+/// to the next one.
+snrt_dimc_txid_t snrt_dimc_load_weights_async(uint32_t core_idx,
+                                              uint32_t macro, uint32_t row,
+                                              uint32_t sec, const void *src,
+                                              size_t nr_sections) {
+    uint32_t dst = snrt_peripherals()->dimc_kernel + (core_idx << 15) +
+                   (macro << 12) + (row << 7) + (sec << 5);
+    return snrt_dma_start_1d((void *)dst, src,
+                             nr_sections * SNRT_DIMC_SECTION_SIZE);
+}
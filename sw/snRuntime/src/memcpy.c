@@ -6,18 +6,154 @@
 
 #include "snrt.h"
 
-// TODO: Implement using cluster DMA for a faster `memcpy`.
+// `snrt_memcpy` and `snrt_memset` run copies and fills of at least this many
+// bytes on the Spatz of the calling core. Spatz can only reach the TCDM,
+// everything else is done by the scalar core. The plain `memcpy` and `memset`,
+// which the compiler also calls on its own, stay scalar so they never touch
+// vector state the caller holds in inline assembly.
+#ifndef SNRT_MEMCPY_VEC_THRESHOLD
+#define SNRT_MEMCPY_VEC_THRESHOLD 32
+#endif
+
+// `snrt_memcpy` hands copies of at least this many bytes that leave the TCDM
+// to the cluster DMA, if it is called on the core that owns it.
+#ifndef SNRT_MEMCPY_DMA_THRESHOLD
+#define SNRT_MEMCPY_DMA_THRESHOLD 256
+#endif
+
+// Whether [ptr, ptr + n) lies in the TCDM of the calling cluster
+static inline int in_tcdm(const void *ptr, size_t n) {
+    snrt_slice_t tcdm = snrt_cluster_memory();
+    uint32_t size = (uint32_t)snrt_slice_len(tcdm);
+    uint32_t off = (uint32_t)ptr - (uint32_t)tcdm.start;
+    return off < size && n <= size - off;
+}
+
+// Word-wise if both pointers are word-aligned, byte-wise otherwise
+static inline void scalar_memcpy(void *dest, const void *src, size_t n) {
+    char *cdest = (char *)dest;
+    const char *csrc = (const char *)src;
+
+    if ((((uint32_t)cdest | (uint32_t)csrc) & 3) == 0) {
+        for (; n >= 4; n -= 4, cdest += 4, csrc += 4)
+            *(uint32_t *)cdest = *(const uint32_t *)csrc;
+    }
+    for (; n; --n) *cdest++ = *csrc++;
+}
+
+static inline void scalar_memset(void *ptr, uint8_t value, size_t n) {
+    uint8_t *cptr = (uint8_t *)ptr;
+
+    if (((uint32_t)cptr & 3) == 0) {
+        uint32_t word = value * 0x01010101u;
+        for (; n >= 4; n -= 4, cptr += 4) *(uint32_t *)cptr = word;
+    }
+    for (; n; --n) *cptr++ = value;
+}
+
+// Stripmined vector copy, 32-bit elements if both pointers and the length are
+// word-aligned
+static inline void vector_memcpy(void *dest, const void *src, size_t n) {
+    char *cdest = (char *)dest;
+    const char *csrc = (const char *)src;
+    size_t vl;
+
+    if ((((uint32_t)cdest | (uint32_t)csrc | n) & 3) == 0) {
+        for (size_t avl = n / 4; avl; avl -= vl) {
+            asm volatile(
+                "vsetvli %0, %1, e32, m8, ta, ma\n"
+                "vle32.v v0, (%2)\n"
+                "vse32.v v0, (%3)"
+                : "=&r"(vl)
+                : "r"(avl), "r"(csrc), "r"(cdest)
+                : "v0", "v1", "v2", "v3", "v4", "v5", "v6", "v7", "vl",
+                  "vtype", "memory");
+            csrc += 4 * vl;
+            cdest += 4 * vl;
+        }
+    } else {
+        for (size_t avl = n; avl; avl -= vl) {
+            asm volatile(
+                "vsetvli %0, %1, e8, m8, ta, ma\n"
+                "vle8.v v0, (%2)\n"
+                "vse8.v v0, (%3)"
+                : "=&r"(vl)
+                : "r"(avl), "r"(csrc), "r"(cdest)
+                : "v0", "v1", "v2", "v3", "v4", "v5", "v6", "v7", "vl",
+                  "vtype", "memory");
+            csrc += vl;
+            cdest += vl;
+        }
+    }
+}
+
+static inline void vector_memset(void *ptr, uint8_t value, size_t n) {
+    uint8_t *cptr = (uint8_t *)ptr;
+    size_t vl;
+
+    if ((((uint32_t)cptr | n) & 3) == 0) {
+        uint32_t word = value * 0x01010101u;
+        for (size_t avl = n / 4; avl; avl -= vl) {
+            asm volatile(
+                "vsetvli %0, %1, e32, m8, ta, ma\n"
+                "vmv.v.x v0, %2\n"
+                "vse32.v v0, (%3)"
+                : "=&r"(vl)
+                : "r"(avl), "r"(word), "r"(cptr)
+                : "v0", "v1", "v2", "v3", "v4", "v5", "v6", "v7", "vl",
+                  "vtype", "memory");
+            cptr += 4 * vl;
+        }
+    } else {
+        for (size_t avl = n; avl; avl -= vl) {
+            asm volatile(
+                "vsetvli %0, %1, e8, m8, ta, ma\n"
+                "vmv.v.x v0, %2\n"
+                "vse8.v v0, (%3)"
+                : "=&r"(vl)
+                : "r"(avl), "r"((uint32_t)value), "r"(cptr)
+                : "v0", "v1", "v2", "v3", "v4", "v5", "v6", "v7", "vl",
+                  "vtype", "memory");
+            cptr += vl;
+        }
+    }
+}
+
+/**
+ * @brief Copy memory, on the Spatz within the TCDM and with the cluster DMA
+ * for large transfers to or from outside the TCDM when called on the core
+ * that owns it
+ * @details Blocks until the copy is done. Clobbers the vector registers.
+ */
 void *snrt_memcpy(void *dst, const void *src, size_t n) {
-    return memcpy(dst, src, n);
+    int local = in_tcdm(dst, n) && in_tcdm(src, n);
+    if (n >= SNRT_MEMCPY_DMA_THRESHOLD && !local && snrt_is_xdma_core())
+        snrt_dma_wait(snrt_dma_start_1d(dst, src, n));
+    else if (n >= SNRT_MEMCPY_VEC_THRESHOLD && local)
+        vector_memcpy(dst, src, n);
+    else
+        scalar_memcpy(dst, src, n);
+    return dst;
 }
 
-void* memcpy(void *dest, const void *src, size_t n) {
-  const char *csrc = (const char *)src;
-  char *cdest = (char *)dest;
+/**
+ * @brief Fill memory with a byte value, on the Spatz within the TCDM
+ * @details Clobbers the vector registers.
+ */
+void *snrt_memset(void *ptr, int value, size_t num) {
+    if (num >= SNRT_MEMCPY_VEC_THRESHOLD && in_tcdm(ptr, num))
+        vector_memset(ptr, (uint8_t)value, num);
+    else
+        scalar_memset(ptr, (uint8_t)value, num);
+    return ptr;
+}
 
-  // Copy contents of src[] to dest[]
-  for (size_t i = 0; i < n; ++i)
-    cdest[i] = csrc[i];
+void *memcpy(void *dest, const void *src, size_t n) {
+    scalar_memcpy(dest, src, n);
+    return dest;
+}
 
-  return dest;
+void *memset(void *ptr, int value, size_t n) {
+    scalar_memset(ptr, (uint8_t)value, n);
+    return ptr;
 }
@@ -124,7 +124,7 @@ void __kmpc_barrier(ident_t *loc, kmp_int32 tid) {
     _OMP_T *_this = omp_getData();
     uint32_t ret;
     KMP_PRINTF(50, "barrier numThreads: %d\n", (uint32_t)_this->numThreads);
-    snrt_barrier(_this->kmpc_barrier, (uint32_t)_this->numThreads);
+    snrt_sleep_barrier(_this->kmpc_barrier, (uint32_t)_this->numThreads);
 }
 
 /*!
@@ -384,6 +384,60 @@ void __kmpc_for_static_init_8u(ident_t *loc, kmp_int32 gtid, kmp_int32 sched,
 //================================================================================
 #ifndef OMPSTATIC_NUMTHREADS
 
+/**
+ * @brief The dynamically scheduled loop the calling thread is in. Every thread
+ * derives the same parameters from the arguments of __kmpc_dispatch_init_4,
+ * only the chunk counter in `buf` is shared.
+ */
+static __thread struct {
+    volatile omp_dispatch_t *buf;
+    kmp_uint32 loop;
+    kmp_int32 lb;
+    kmp_int32 st;
+    kmp_uint32 trip;
+    kmp_uint32 chunk;
+    kmp_uint32 nthreads;
+    int guided;
+} dispatch;
+
+/**
+ * @brief Iterations [start, start + size) of chunk `ticket`
+ * @details Dynamic loops hand out chunks of `chunk` iterations. Guided loops
+ * hand out rounds of one chunk per thread, each chunk a `1 / (2 * nthreads)`
+ * share of the iterations left before the round, down to `chunk` iterations.
+ * Each round thus halves the remaining iterations, and the chunk of a ticket
+ * follows from the ticket alone, so a single AMO hands it out.
+ *
+ * @return 0 if the loop is exhausted
+ */
+static int dispatch_chunk(kmp_uint32 ticket, kmp_uint32 *start,
+                          kmp_uint32 *size) {
+    kmp_uint32 base = 0;
+    kmp_uint32 left = dispatch.trip;
+    kmp_uint32 n = dispatch.nthreads;
+
+    if (dispatch.guided) {
+        while (left) {
+            kmp_uint32 c = (left + 2 * n - 1) / (2 * n);
+            if (c <= dispatch.chunk) break;
+            if (ticket < n) {
+                *start = base + ticket * c;
+                *size = c;
+                return 1;
+            }
+            ticket -= n;
+            base += n * c;
+            left -= n * c;
+        }
+    }
+
+    if (ticket >= (left + dispatch.chunk - 1) / dispatch.chunk) return 0;
+    *start = base + ticket * dispatch.chunk;
+    *size = dispatch.trip - *start < dispatch.chunk ? dispatch.trip - *start
+                                                    : dispatch.chunk;
+    return 1;
+}
+
 /*!
 @ingroup WORK_SHARING
 @{
@@ -404,32 +458,37 @@ void __kmpc_dispatch_init_4(ident_t *loc, kmp_int32 gtid,
                             kmp_int32 ub, kmp_int32 st, kmp_int32 chunk) {
     (void)loc;
     (void)gtid;
-    (void)schedule;
     omp_team_t *team = omp_get_team(omp_getData());
-    // dynLoopInitNoIter(team, lb, ub, st, chunk);
-    // int core_id = omp_get_thread_num();
-    eu_mutex_lock();
-    // if (team->loop_epoch - team->core_epoch[core_id] != 0)
-    // {
-    //   eu_mutex_release();
-    //   team->core_epoch[core_id]++;
-    //   KMP_PRINTF(10, "__kmpc_dispatch_init_4 core_epoch[%d] =
-    //   %d\n",core_id,team->core_epoch[core_id]); return;
-    // }
-
-    if (!team->loop_is_setup) {
-        team->loop_is_setup = 1;
-        team->loop_start = lb;
-        team->loop_end = ub;
-        team->loop_incr = st;
-        team->loop_chunk = chunk;
-        KMP_PRINTF(
-            10,
-            "__kmpc_dispatch_init_4 setup: start %d end %d incr %d chunk %d\n",
-            team->loop_start, team->loop_end, team->loop_incr,
-            team->loop_chunk);
-    }
-    eu_mutex_release();
+    kmp_uint32 loop = ++team->core_loop[omp_get_thread_num()];
+
+    dispatch.buf = &team->dispatch[(loop - 1) % OMP_DISPATCH_BUFS];
+    dispatch.loop = loop;
+    dispatch.lb = lb;
+    dispatch.st = st;
+    if (st > 0)
+        dispatch.trip = ub < lb ? 0 : (kmp_uint32)(ub - lb) / st + 1;
+    else
+        dispatch.trip = lb < ub ? 0 : (kmp_uint32)(lb - ub) / -st + 1;
+    dispatch.nthreads = team->nbThreads;
+
+    schedule = SCHEDULE_WITHOUT_MODIFIERS(schedule);
+    dispatch.guided = schedule == kmp_sch_guided_chunked ||
+                      schedule == kmp_sch_guided_iterative_chunked ||
+                      schedule == kmp_sch_guided_analytical_chunked ||
+                      schedule == kmp_sch_guided_simd;
+    if (schedule != kmp_sch_dynamic_chunked && !dispatch.guided)
+        // static, runtime and auto: one block per thread
+        chunk = (dispatch.trip + dispatch.nthreads - 1) / dispatch.nthreads;
+    dispatch.chunk = chunk > 0 ? chunk : 1;
+
+    // Wait for the threads still in the loop that used the buffer before
+    while (__atomic_load_n(&dispatch.buf->loop, __ATOMIC_ACQUIRE) != loop)
+        ;
+
+    KMP_PRINTF(10,
+               "__kmpc_dispatch_init_4 loop %d: lb %d trip %d st %d chunk %d "
+               "guided %d\n",
+               loop, lb, dispatch.trip, st, dispatch.chunk, dispatch.guided);
 }
 
 /*!
@@ -460,38 +519,31 @@ int __kmpc_dispatch_next_4(ident_t *loc, kmp_int32 gtid, kmp_int32 *p_last,
                            kmp_int32 *p_lb, kmp_int32 *p_ub, kmp_int32 *p_st) {
     (void)loc;
     (void)gtid;
-
-    omp_team_t *team = omp_get_team(omp_getData());
-
-    // The stride is actually always 1
-    *p_st = 1;
-
-    // int result = dynLoopIter(team, (int*) p_lb, (int*) p_ub, (int*) p_last);
-    eu_mutex_lock();
-
-    // have already iterated over all the iterations(no more work), return 0
-    if (team->loop_start > team->loop_end) {
-        team->loop_is_setup = 0;
-        KMP_PRINTF(
-            10, "__kmpc_dispatch_next_4 start > end: team->loop_is_setup %d\n",
-            team->loop_is_setup);
-        eu_mutex_release();
+    volatile omp_dispatch_t *buf = dispatch.buf;
+    kmp_uint32 start, size;
+
+    kmp_uint32 ticket = __atomic_fetch_add(&buf->next, 1, __ATOMIC_RELAXED);
+    if (!dispatch_chunk(ticket, &start, &size)) {
+        // The last thread out hands the buffer to the loop that uses it next
+        if (__atomic_add_fetch(&buf->fini, 1, __ATOMIC_RELAXED) ==
+            dispatch.nthreads) {
+            buf->next = 0;
+            buf->fini = 0;
+            __atomic_store_n(&buf->loop, dispatch.loop + OMP_DISPATCH_BUFS,
+                             __ATOMIC_RELEASE);
+        }
+        KMP_PRINTF(10, "__kmpc_dispatch_next_4 loop %d done\n", dispatch.loop);
         return 0;
     }
 
-    *p_lb = team->loop_start;
-    *p_ub = *p_lb + team->loop_chunk - 1;
-    if (*p_ub >= team->loop_end) {
-        *p_ub = team->loop_end;
-        *p_last = 1;
-    }
-
-    team->loop_start += team->loop_chunk;
+    *p_lb = dispatch.lb + (kmp_int32)start * dispatch.st;
+    *p_ub = dispatch.lb + (kmp_int32)(start + size - 1) * dispatch.st;
+    *p_st = dispatch.st;
+    if (p_last) *p_last = start + size == dispatch.trip;
     KMP_PRINTF(10,
                "__kmpc_dispatch_next_4 : last: %d [l %4d u %4d s %4d] "
-               "team->loop_start %d\n",
-               *p_last, *p_lb, *p_ub, *p_st, team->loop_start);
-    eu_mutex_release();
+               "ticket %d\n",
+               start + size == dispatch.trip, *p_lb, *p_ub, *p_st, ticket);
     return 1;
 }
 
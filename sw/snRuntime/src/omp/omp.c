@@ -47,6 +47,23 @@ static inline void initTeam(omp_t *_this, omp_team_t *team) {
     (void)team;
 }
 
+#ifndef OMPSTATIC_NUMTHREADS
+/**
+ * @brief Reset the dynamic loop state at the start of a parallel region, while
+ * all workers are parked
+ */
+static void resetDispatch(volatile omp_team_t *team) {
+    for (uint32_t i = 0; i < OMP_DISPATCH_BUFS; i++) {
+        team->dispatch[i].loop = i + 1;
+        team->dispatch[i].next = 0;
+        team->dispatch[i].fini = 0;
+    }
+    for (uint32_t i = 0; i < sizeof(team->core_loop) / sizeof(team->core_loop[0]);
+         i++)
+        team->core_loop[i] = 0;
+}
+#endif
+
 void omp_init(void) {
     if (snrt_cluster_core_idx() == 0) {
         // allocate space for kmp arguments
@@ -59,13 +76,7 @@ void omp_init(void) {
         omp_p->maxThreads = nbCores;
 
         omp_p->plainTeam.nbThreads = nbCores;
-        omp_p->plainTeam.loop_epoch = 0;
-        omp_p->plainTeam.loop_is_setup = 0;
-
-        for (int i = 0; i < sizeof(omp_p->plainTeam.core_epoch) /
-                                sizeof(omp_p->plainTeam.core_epoch[0]);
-             i++)
-            omp_p->plainTeam.core_epoch[i] = 0;
+        resetDispatch(&omp_p->plainTeam);
 
         initTeam(omp_p, &omp_p->plainTeam);
         omp_p->kmpc_barrier =
@@ -134,6 +145,7 @@ void partialParallelRegion(int32_t argc, void *data,
                            void (*fn)(void *, uint32_t), int num_threads) {
 #ifndef OMPSTATIC_NUMTHREADS
     omp_p->plainTeam.nbThreads = num_threads;
+    resetDispatch(&omp_p->plainTeam);
 #endif
 
     OMP_PRINTF(10, "num_threads=%d nbThreads=%d omp_p->numThreads=%d\n",
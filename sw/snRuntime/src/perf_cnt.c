@@ -3,13 +3,26 @@
 // SPDX-License-Identifier: Apache-2.0
 #include "perf_cnt.h"
 
+#include "spatz_cluster_peripheral.h"
+
 // Enable a specific perf_counter
 void snrt_start_perf_counter(enum snrt_perf_cnt perf_cnt,
                              enum snrt_perf_cnt_type perf_cnt_type,
                              uint32_t hart_id) {
     perf_reg_t *perf_reg = (void *)snrt_peripherals()->perf_counters;
     perf_reg->hart_select[perf_cnt].value |= hart_id;
-    perf_reg->enable[perf_cnt].value = (0x1 << perf_cnt_type);
+    perf_reg->enable[perf_cnt].value = (0x1u << perf_cnt_type);
+}
+
+// Count a DIMC event on a specific perf_counter
+void snrt_start_perf_counter_dimc(enum snrt_perf_cnt perf_cnt,
+                                  enum snrt_perf_cnt_dimc_event event,
+                                  uint32_t hart_id) {
+    volatile perf_reg32_t *event_select =
+        (void *)((uintptr_t)snrt_peripherals()->perf_counters +
+                 SPATZ_CLUSTER_PERIPHERAL_DIMC_EVENT_SELECT_0_REG_OFFSET);
+    event_select[perf_cnt].value = event;
+    snrt_start_perf_counter(perf_cnt, SNRT_PERF_CNT_DIMC, hart_id);
 }
 
 // Stops the counter but does not reset it
@@ -0,0 +1,101 @@
+// Copyright 2020 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+#include "pipeline.h"
+
+#include "debug.h"
+
+int snrt_pipeline_init(snrt_pipeline_t *p, snrt_pipeline_dir_t dir,
+                       const snrt_pipeline_layout_t *layout,
+                       uint32_t nr_tiles, uint32_t nr_slots,
+                       uint32_t nr_consumers) {
+    if (nr_slots < 1) nr_slots = 1;
+    if (nr_slots > SNRT_PIPELINE_MAX_SLOTS) nr_slots = SNRT_PIPELINE_MAX_SLOTS;
+    if (nr_consumers < 1) nr_consumers = 1;
+
+    p->dir = dir;
+    p->layout = *layout;
+    p->nr_tiles = nr_tiles;
+    p->nr_slots = nr_slots;
+    p->nr_consumers = nr_consumers;
+    p->issued = 0;
+    p->retired = 0;
+    p->done = 0;
+    for (uint32_t s = 0; s < SNRT_PIPELINE_MAX_SLOTS; s++) p->released[s] = 0;
+
+    // Stagger the slots over the TCDM banks, they are accessed together
+    size_t sizes[SNRT_PIPELINE_MAX_SLOTS];
+    for (uint32_t s = 0; s < nr_slots; s++)
+        sizes[s] = layout->size * layout->repeat;
+    if (snrt_l1alloc_staggered(p->slot, sizes, nr_slots)) {
+        snrt_trace(SNRT_TRACE_ALLOC, "Pipeline slots do not fit: %d x %#x\n",
+                   nr_slots, sizes[0]);
+        return -1;
+    }
+    return 0;
+}
+
+void snrt_pipeline_free(snrt_pipeline_t *p) {
+    for (uint32_t s = p->nr_slots; s > 0; s--) snrt_l1free(p->slot[s - 1]);
+}
+
+static inline snrt_dma_txid_t pipeline_start(snrt_pipeline_t *p,
+                                             uint32_t tile) {
+    const snrt_pipeline_layout_t *l = &p->layout;
+    uint64_t ext = l->base + (uint64_t)tile * l->tile_stride;
+    uint64_t slot = (uint32_t)p->slot[tile % p->nr_slots];
+
+    if (p->dir == SNRT_PIPELINE_IN)
+        return snrt_dma_start_2d_wideptr(slot, ext, l->size, l->size,
+                                         l->stride, l->repeat);
+    else
+        return snrt_dma_start_2d_wideptr(ext, slot, l->size, l->stride,
+                                         l->size, l->repeat);
+}
+
+int snrt_pipeline_dm_step(snrt_pipeline_t *p) {
+    // Collect the tiles that all consumers are done with, in order. Nobody
+    // touches a slot's counter until its next tile has been acquired, which
+    // needs a transfer started below.
+    uint32_t limit = p->dir == SNRT_PIPELINE_IN ? p->done : p->nr_tiles;
+    while (p->retired < limit) {
+        volatile uint32_t *released = &p->released[p->retired % p->nr_slots];
+        if (__atomic_load_n(released, __ATOMIC_ACQUIRE) != p->nr_consumers)
+            break;
+        *released = 0;
+        p->retired++;
+    }
+
+    // Start every transfer that can go: loads into slots whose previous tile
+    // has been released, stores of tiles that have been released
+    while (p->issued < p->nr_tiles) {
+        if (p->dir == SNRT_PIPELINE_IN) {
+            if (p->issued >= p->retired + p->nr_slots) break;
+        } else {
+            if (p->issued >= p->retired) break;
+        }
+        p->txid[p->issued % p->nr_slots] = pipeline_start(p, p->issued);
+        p->issued++;
+    }
+
+    // Retire the oldest transfer in flight
+    if (p->done < p->issued) {
+        snrt_dma_wait(p->txid[p->done % p->nr_slots]);
+        __atomic_store_n(&p->done, p->done + 1, __ATOMIC_RELEASE);
+    }
+
+    return p->done < p->nr_tiles;
+}
+
+void snrt_pipeline_dm_run(snrt_pipeline_t *const *p, uint32_t num) {
+    uint32_t busy;
+    do {
+        busy = 0;
+        for (uint32_t i = 0; i < num; i++)
+            if (p[i]->done < p[i]->nr_tiles)
+                busy |= snrt_pipeline_dm_step(p[i]);
+    } while (busy);
+
+    // Output tiles are only complete once the last store has landed
+    snrt_dma_wait_all();
+}
@@ -11,6 +11,15 @@ extern const uint32_t _snrt_cluster_cluster_id;
 
 const uint32_t snrt_stack_size __attribute__((weak, section(".rodata"))) = 10;
 
+// Clusters in the system and the hart id of the first core of cluster 0, from
+// the system config
+#ifndef SNRT_CLUSTER_NUM
+#define SNRT_CLUSTER_NUM 1
+#endif
+#ifndef SNRT_BASE_HARTID
+#define SNRT_BASE_HARTID 0
+#endif
+
 // The boot data generated along with the system RTL.
 // See `ip/test/src/tb_lib.hh` for details.
 struct snrt_cluster_bootdata {
@@ -45,9 +54,9 @@ void _snrt_init_team(uint32_t cluster_core_id, uint32_t cluster_core_num,
     team->bootdata = (void *)bootdata;
     team->global_core_base_hartid = bootdata->hartid_base;
     team->global_core_num = bootdata->core_count;
-    team->cluster_idx =
-        (snrt_hartid() - bootdata->hartid_base) / bootdata->core_count;
-    team->cluster_num = 0;
+    // Clusters are numbered like in the startup code
+    team->cluster_idx = (snrt_hartid() - SNRT_BASE_HARTID) / cluster_core_num;
+    team->cluster_num = SNRT_CLUSTER_NUM;
     team->cluster_core_base_hartid = bootdata->hartid_base;
     team->cluster_core_num = cluster_core_num;
     team->global_mem.start = (uint64_t)bootdata->global_mem_start;
@@ -60,6 +69,7 @@ void _snrt_init_team(uint32_t cluster_core_id, uint32_t cluster_core_num,
     // Initialize cluster barrier
     team->cluster_barrier.barrier = 0;
     team->cluster_barrier.barrier_iteration = 0;
+    team->cluster_barrier.sleepers = 0;
 
     // TLS caches of frequently used data
     _snrt_team_current = &team->base;
@@ -81,8 +91,12 @@ void _snrt_init_team(uint32_t cluster_core_id, uint32_t cluster_core_num,
     team->peripherals.cl_clint =
         (uint32_t *)(spm_start + bootdata->tcdm_size +
                      SPATZ_CLUSTER_PERIPHERAL_CL_CLINT_SET_REG_OFFSET);
+    team->peripherals.dimc_kernel =
+        (uint32_t)spm_start + bootdata->tcdm_size + SNRT_CLUSTER_PERIPH_SIZE;
 
     // Init allocator
-    snrt_alloc_init(team, sizeof(struct putc_buffer));
+    // Skip the putc buffers of all harts, indexed by hart id
+    snrt_alloc_init(team, sizeof(struct putc_buffer) *
+                              (bootdata->hartid_base + bootdata->core_count));
     snrt_int_init(team);
 }
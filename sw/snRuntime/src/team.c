@@ -6,6 +6,11 @@
 #include "snrt.h"
 #include "spatz_cluster_peripheral.h"
 
+// Cluster core with the DMA, from the cluster config; -1 for the last core
+#ifndef SNRT_XDMA_CORE_IDX
+#define SNRT_XDMA_CORE_IDX -1
+#endif
+
 // TLS copy of frequently used data that doesn't change at runtime
 __thread struct snrt_team *_snrt_team_current;
 __thread uint32_t _snrt_core_idx;
@@ -77,6 +82,15 @@ int snrt_is_dm_core() {
     return !snrt_is_compute_core();
 }
 
+uint32_t snrt_cluster_xdma_core_idx() {
+    return SNRT_XDMA_CORE_IDX < 0 ? snrt_cluster_core_num() - 1
+                                  : SNRT_XDMA_CORE_IDX;
+}
+
+int snrt_is_xdma_core() {
+    return snrt_cluster_core_idx() == snrt_cluster_xdma_core_idx();
+}
+
 uint32_t _snrt_barrier_reg_ptr() {
     return _snrt_team_current->root->barrier_reg_ptr;
 }
@@ -0,0 +1,79 @@
+// Copyright 2020 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+#include <snrt.h>
+
+int main() {
+    if (snrt_cluster_core_idx() != 0) return 0;
+
+    uint32_t errors = 0;
+
+    // Freed small blocks are reused for the same size class
+    void *a = snrt_l1alloc(24);
+    void *b = snrt_l1alloc(24);
+    snrt_l1free(a);
+    if (snrt_l1alloc(20) != a) errors++;
+
+    // Freeing the top of the heap shrinks it
+    snrt_l1_mark_t top = snrt_l1_mark();
+    void *c = snrt_l1alloc(4096);
+    snrt_l1free(c);
+    if (snrt_l1_mark() != top) errors++;
+
+    // Large blocks coalesce and are split again
+    void *d = snrt_l1alloc(2048);
+    void *e = snrt_l1alloc(2048);
+    void *guard = snrt_l1alloc(8);
+    snrt_l1free(d);
+    snrt_l1free(e);
+    void *de = snrt_l1alloc(3072);
+    if (de != d) errors++;
+    snrt_l1free(de);
+
+    // Bank-row alignment
+    uint32_t row = snrt_l1_bank_row();
+    void *f[4];
+    for (uint32_t i = 0; i < 4; i++) {
+        f[i] = snrt_l1alloc_aligned(100 * i + 1, row);
+        if ((uint32_t)f[i] % row) errors++;
+    }
+    for (uint32_t i = 0; i < 4; i++) snrt_l1free(f[i]);
+
+    // A release drops everything allocated after the mark
+    snrt_l1_mark_t mark = snrt_l1_mark();
+    for (uint32_t i = 0; i < 8; i++) snrt_l1alloc(1500);
+    snrt_l1_release(mark);
+    if (snrt_l1_mark() != mark) errors++;
+
+    // Size-class blocks go back to the heap once it runs out, so a heap
+    // filled with small blocks still serves a large one after they are freed
+    void **list = 0;
+    uint32_t nr_small = 0;
+    for (void **s; (s = snrt_l1alloc(64)); nr_small++) {
+        *s = list;
+        list = s;
+    }
+    void **last = list;
+    for (void **s = *last, **next; s; s = next) {
+        next = *s;
+        snrt_l1free(s);
+    }
+    void *large = snrt_l1alloc(nr_small * 64 / 2);
+    if (!large) errors++;
+    snrt_l1free(large);
+    snrt_l1free(last);
+    if (snrt_l1_mark() != mark) errors++;
+
+    snrt_l1free(b);
+    snrt_l1free(guard);
+
+    // L3 blocks coalesce and oversized requests fail
+    void *g = snrt_l3alloc(4096);
+    void *h = snrt_l3alloc(4096);
+    snrt_l3free(g);
+    snrt_l3free(h);
+    if (snrt_l3alloc(8192) != g) errors++;
+    if (snrt_l3alloc(0xffffff00)) errors++;
+    snrt_l3free(g);
+    return errors;
+}
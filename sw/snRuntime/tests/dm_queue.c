@@ -0,0 +1,90 @@
+// Copyright 2020 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+#include <snrt.h>
+
+#include "dm.h"
+
+// Rows of ROW bytes, copied through the DM task queue
+#define ROW 16
+#define TILE_ROWS 8
+#define ROWS_PER_CORE 12
+// Rows each producer queues before it wakes the DM core. Two copies per row,
+// so the bursts of up to four producers fit the 16-entry queue.
+#define BURST 2
+
+static uint8_t *src_old, *src_new, *dst;
+static struct snrt_barrier producers;
+
+static inline uint8_t pattern(uint32_t row, uint32_t i) {
+    return (uint8_t)(row * 7 + i * 3 + 1);
+}
+
+int main() {
+    uint32_t core_id = snrt_cluster_core_idx();
+    uint32_t nr_producers = snrt_cluster_compute_core_num();
+    uint32_t nr_rows = nr_producers * ROWS_PER_CORE;
+    uint32_t errors = 0;
+
+    // The DM core needs at least one producer to send it back, and the DMA
+    // to move the rows
+    if (nr_producers == 0 ||
+        snrt_cluster_xdma_core_idx() != snrt_cluster_dm_core_idx())
+        return 0;
+
+    if (core_id == 0) {
+        src_old = snrt_l1alloc(nr_rows * ROW);
+        src_new = snrt_l1alloc(nr_rows * ROW);
+        // Every other row of dst is padding that must stay untouched
+        dst = snrt_l1alloc(2 * nr_rows * ROW);
+        for (uint32_t r = 0; r < nr_rows; r++)
+            for (uint32_t i = 0; i < ROW; i++) {
+                src_old[r * ROW + i] = 0;
+                src_new[r * ROW + i] = pattern(r, i);
+                dst[2 * r * ROW + i] = 0xaa;
+                dst[(2 * r + 1) * ROW + i] = 0xaa;
+            }
+    }
+    snrt_cluster_hw_barrier();
+
+    dm_init();
+    if (snrt_is_dm_core()) {
+        dm_main();
+        return 0;
+    }
+
+    // Rows of a tile queued one by one, merged into one 2D transfer
+    if (core_id == 0) {
+        for (uint32_t r = 0; r < TILE_ROWS; r++)
+            dm_memcpy_async(dst + 2 * r * ROW, src_new + r * ROW, ROW);
+        dm_wait();
+        for (uint32_t r = 0; r < TILE_ROWS; r++)
+            for (uint32_t i = 0; i < ROW; i++) {
+                errors += dst[2 * r * ROW + i] != pattern(r, i);
+                errors += dst[(2 * r + 1) * ROW + i] != 0xaa;
+            }
+    }
+    snrt_barrier(&producers, nr_producers);
+
+    // All producers at once, with rows interleaved between them. Every row is
+    // written twice and must end up with the second copy.
+    for (uint32_t k = 0; k < ROWS_PER_CORE; k++) {
+        uint32_t r = k * nr_producers + core_id;
+        dm_memcpy_async(dst + 2 * r * ROW, src_old + r * ROW, ROW);
+        dm_memcpy_async(dst + 2 * r * ROW, src_new + r * ROW, ROW);
+        if (k % BURST == BURST - 1) dm_start();
+    }
+    snrt_barrier(&producers, nr_producers);
+
+    if (core_id == 0) {
+        dm_wait();
+        for (uint32_t r = 0; r < nr_rows; r++)
+            for (uint32_t i = 0; i < ROW; i++) {
+                errors += dst[2 * r * ROW + i] != pattern(r, i);
+                errors += dst[(2 * r + 1) * ROW + i] != 0xaa;
+            }
+        dm_exit();
+    }
+
+    return errors;
+}
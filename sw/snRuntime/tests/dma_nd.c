@@ -0,0 +1,57 @@
+// Copyright 2020 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <snrt.h>
+
+// A 2x3x4x8 tensor of words in main memory, from which a 2x2x3x4 tile is
+// copied into L1 with a single N-dimensional transfer.
+#define N 2
+#define C 3
+#define H 4
+#define W 8
+uint32_t tensor[N][C][H][W];
+
+int main() {
+    if (!snrt_is_xdma_core()) return 0;
+    uint32_t errors = 0;
+
+    for (uint32_t i = 0; i < N * C * H * W; i++) (&tensor[0][0][0][0])[i] = i;
+
+    // Tile at c = 1, h = 1, w = 2, packed in L1
+    uint32_t tile[N][2][3][4];
+    const size_t src_strides[] = {W * 4, H * W * 4, C * H * W * 4};
+    const size_t dst_strides[] = {4 * 4, 3 * 4 * 4, 2 * 3 * 4 * 4};
+    const size_t repeats[] = {3, 2, N};
+    snrt_dma_wait(snrt_dma_start_nd(tile, &tensor[0][1][1][2], 4 * 4,
+                                    dst_strides, src_strides, repeats, 4));
+
+    for (uint32_t n = 0; n < N; n++)
+        for (uint32_t c = 0; c < 2; c++)
+            for (uint32_t h = 0; h < 3; h++)
+                for (uint32_t w = 0; w < 4; w++)
+                    errors += tile[n][c][h][w] != tensor[n][c + 1][h + 1][w + 2];
+
+    // Contiguous dimensions collapse into a single 1D transfer
+    uint32_t flat[C * H * W];
+    const size_t flat_strides[] = {W * 4, H * W * 4};
+    const size_t flat_repeats[] = {H, C};
+    snrt_dma_wait(snrt_dma_start_nd(flat, &tensor[1][0][0][0], W * 4,
+                                    flat_strides, flat_strides, flat_repeats,
+                                    3));
+
+    for (uint32_t i = 0; i < C * H * W; i++)
+        errors += flat[i] != (&tensor[1][0][0][0])[i];
+
+    // Too many dimensions are rejected without touching the destination
+    const size_t deep[SNRT_DMA_MAX_DIMS] = {4, 4, 4, 4};
+    flat[0] = ~0u;
+    snrt_dma_txid_t txid = snrt_dma_start_nd(flat, &tensor[0][0][0][0], 4,
+                                             deep, deep, deep,
+                                             SNRT_DMA_MAX_DIMS + 1);
+    snrt_dma_wait(txid);
+    errors += txid != SNRT_DMA_TXID_INVALID;
+    errors += flat[0] != ~0u;
+
+    return errors;
+}
@@ -0,0 +1,26 @@
+// Copyright 2020 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+#include <snrt.h>
+
+// Arrivals of the clusters, counted by core 0 of each
+static volatile uint32_t arrived __attribute__((section(".dram")));
+
+int main() {
+    uint32_t cluster_num = snrt_cluster_num();
+    uint32_t errors = 0;
+
+    if (snrt_cluster_idx() >= cluster_num) errors++;
+
+    for (uint32_t round = 1; round <= 4; round++) {
+        if (snrt_cluster_core_idx() == 0)
+            __atomic_add_fetch(&arrived, 1, __ATOMIC_RELAXED);
+        snrt_global_barrier();
+        // All clusters have arrived, and none arrives again before every
+        // core has checked
+        if (arrived != round * cluster_num) errors++;
+        snrt_global_barrier();
+    }
+
+    return errors;
+}
@@ -0,0 +1,35 @@
+// Copyright 2020 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+#include <snrt.h>
+
+#define ROUNDS 8
+
+static snrt_sleep_mutex_t mtx = {0};
+static volatile uint32_t counter = 0;
+
+int main() {
+    uint32_t core_id = snrt_cluster_core_idx();
+    uint32_t core_num = snrt_cluster_core_num();
+
+    for (uint32_t r = 0; r < ROUNDS; r++) {
+        // Core 0 is the straggler, the others end up sleeping on the barrier
+        if (core_id == 0)
+            for (volatile uint32_t i = 0; i < 2000; i++)
+                ;
+
+        // Hold the mutex for a while so that the other cores sleep on it
+        snrt_sleep_mutex_lock(&mtx);
+        uint32_t c = counter;
+        for (volatile uint32_t i = 0; i < 100; i++)
+            ;
+        counter = c + 1;
+        snrt_sleep_mutex_release(&mtx);
+
+        snrt_cluster_sw_barrier();
+        if (counter != (r + 1) * core_num) return 1;
+        snrt_cluster_sw_barrier();
+    }
+
+    return 0;
+}
@@ -0,0 +1,188 @@
+// Copyright 2023 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Matmul with A and C resident in DRAM: the core that owns the DMA streams
+// row blocks of A into the TCDM and row blocks of C back out through
+// double-buffered pipelines, while the other cores work on the previous
+// block. Only B is held in the TCDM as a whole. On a single-core cluster the
+// one core drives the pipelines between its own tiles, so the transfers still
+// overlap the compute.
+
+#include <benchmark.h>
+#include <debug.h>
+#include <pipeline.h>
+#include <snrt.h>
+#include <stdio.h>
+
+#include DATAHEADER
+#include "kernel/dp-fmatmul.c"
+
+// Rows of C per compute core and tile, the matmul_4xVL kernel size
+#define ROWS_PER_CORE 4
+#define NR_SLOTS 2
+
+double *b;
+
+snrt_pipeline_t pipe_a;
+snrt_pipeline_t pipe_c;
+
+// Verify the matrices
+int verify_matrix(double *matrix, const double *checksum,
+                  const unsigned int num_rows, const unsigned int num_columns) {
+  for (unsigned int i = 0; i < num_rows; ++i) {
+    double sum = 0;
+    for (unsigned int j = 0; j < num_columns; ++j) {
+      sum += (double)matrix[i * num_columns + j];
+    }
+
+    double diff = sum - (double)checksum[i];
+    if (diff < 0)
+      diff = -diff;
+    if (diff > 0.001) {
+      return i == 0 ? -1 : (int)i;
+    }
+  }
+  return 0;
+}
+
+int main() {
+  const unsigned int cid = snrt_cluster_core_idx();
+  const unsigned int mover = snrt_cluster_xdma_core_idx();
+  const unsigned int single = snrt_cluster_core_num() == 1;
+  // Every core but the mover computes, unless it is the only one
+  const unsigned int num_cores = single ? 1 : snrt_cluster_core_num() - 1;
+  const unsigned int wid = cid > mover ? cid - 1 : cid;
+
+  unsigned int timer = 0;
+
+  // Use as many compute cores as split M into whole tiles
+  unsigned int workers = num_cores;
+  while (gemm_l.M % (ROWS_PER_CORE * workers))
+    workers--;
+
+  const unsigned int tile_m = ROWS_PER_CORE * workers;
+  const unsigned int nr_tiles = gemm_l.M / tile_m;
+
+  if (cid == mover) {
+    b = (double *)snrt_l1alloc(gemm_l.K * gemm_l.N * sizeof(double));
+    snrt_dma_start_1d(b, gemm_B_dram, gemm_l.K * gemm_l.N * sizeof(double));
+
+    const snrt_pipeline_layout_t layout_a = {
+        .base = (uint32_t)gemm_A_dram,
+        .tile_stride = tile_m * gemm_l.K * sizeof(double),
+        .size = gemm_l.K * sizeof(double),
+        .stride = gemm_l.K * sizeof(double),
+        .repeat = tile_m,
+    };
+    const snrt_pipeline_layout_t layout_c = {
+        .base = (uint32_t)gemm_C_dram,
+        .tile_stride = tile_m * gemm_l.N * sizeof(double),
+        .size = gemm_l.N * sizeof(double),
+        .stride = gemm_l.N * sizeof(double),
+        .repeat = tile_m,
+    };
+    snrt_pipeline_init(&pipe_a, SNRT_PIPELINE_IN, &layout_a, nr_tiles,
+                       NR_SLOTS, workers);
+    snrt_pipeline_init(&pipe_c, SNRT_PIPELINE_OUT, &layout_c, nr_tiles,
+                       NR_SLOTS, workers);
+
+    snrt_dma_wait_all();
+  }
+
+  // Wait for all cores to finish
+  snrt_cluster_hw_barrier();
+
+  // Start dump
+  if (cid == 0)
+    start_kernel();
+
+  // Start timer
+  if (cid == 0)
+    timer = benchmark_get_cycle();
+
+  if (single) {
+    // Keep both pipelines going around the compute of every tile
+    for (unsigned int t = 0; t < nr_tiles; ++t) {
+      while (pipe_a.done <= t)
+        snrt_pipeline_dm_step(&pipe_a);
+      while (t >= pipe_c.done + NR_SLOTS)
+        snrt_pipeline_dm_step(&pipe_c);
+      const double *a = snrt_pipeline_acquire(&pipe_a, t);
+      double *c = snrt_pipeline_acquire(&pipe_c, t);
+      matmul_4xVL(c, a, b, 0, tile_m, gemm_l.K, gemm_l.N, 0, gemm_l.N);
+      snrt_pipeline_release(&pipe_a, t);
+      snrt_pipeline_release(&pipe_c, t);
+      snrt_pipeline_dm_step(&pipe_c);
+    }
+    snrt_pipeline_t *const pipes[] = {&pipe_a, &pipe_c};
+    snrt_pipeline_dm_run(pipes, 2);
+  } else if (cid == mover) {
+    snrt_pipeline_t *const pipes[] = {&pipe_a, &pipe_c};
+    snrt_pipeline_dm_run(pipes, 2);
+  } else if (wid < workers) {
+    const unsigned int m_start = ROWS_PER_CORE * wid;
+    const unsigned int m_end = m_start + ROWS_PER_CORE;
+    for (unsigned int t = 0; t < nr_tiles; ++t) {
+      const double *a = snrt_pipeline_acquire(&pipe_a, t);
+      double *c = snrt_pipeline_acquire(&pipe_c, t);
+      matmul_4xVL(c, a, b, m_start, m_end, gemm_l.K, gemm_l.N, 0, gemm_l.N);
+      snrt_pipeline_release(&pipe_a, t);
+      snrt_pipeline_release(&pipe_c, t);
+    }
+  }
+
+  // Wait for all cores to finish
+  snrt_cluster_hw_barrier();
+
+  // End timer
+  if (cid == 0)
+    timer = benchmark_get_cycle() - timer;
+
+  // End dump
+  if (cid == 0)
+    stop_kernel();
+
+  // Check and display results
+  if (cid == 0) {
+    long unsigned int performance =
+        1000 * 2 * gemm_l.M * gemm_l.N * gemm_l.K / timer;
+    long unsigned int utilization =
+        performance / (2 * workers * SNRT_NFPU_PER_CORE);
+
+    PRINTF("\n----- (%dx%d) dp fmatmul, pipelined from DRAM -----\n",
+           gemm_l.M, gemm_l.N);
+    PRINTF("%u cores, %u tiles of %u rows, %u slots\n", workers, nr_tiles,
+           tile_m, NR_SLOTS);
+    PRINTF("The execution took %u cycles.\n", timer);
+    PRINTF("The performance is %ld OP/1000cycle (%ld%%o utilization).\n",
+           performance, utilization);
+  }
+
+  if (cid == 0) {
+    int error = verify_matrix(gemm_C_dram, (const double *)gemm_checksum,
+                              gemm_l.M, gemm_l.N);
+
+    if (error != 0) {
+      PRINTF("Error core %d: c[%d]=%u\n", cid, error, (int)gemm_C_dram[error]);
+      return error;
+    }
+  }
+
+  // Wait for all cores to finish
+  snrt_cluster_hw_barrier();
+
+  return 0;
+}
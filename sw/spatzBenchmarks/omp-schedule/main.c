@@ -0,0 +1,164 @@
+// Copyright 2023 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// OpenMP loop schedules on an imbalanced loop: a lower-triangular
+// matrix-vector product, where row i costs i + 1 multiply-adds. Compares
+// static, dynamic and guided scheduling, and two independent loops with and
+// without `nowait` between them.
+
+#include <benchmark.h>
+#include <debug.h>
+#include <dm.h>
+#include <omp.h>
+#include <snrt.h>
+#include <stdio.h>
+
+#define DIM 256
+
+static double *x;
+static double *y;
+static double *z;
+static double *golden;
+
+// Element (i, j) of the lower-triangular matrix, computed on the fly
+static inline double l_elem(int i, int j) { return (double)((i ^ j) & 7); }
+
+static inline void trmv_row(double *out, int i) {
+  double sum = 0;
+  for (int j = 0; j <= i; ++j)
+    sum += l_elem(i, j) * x[j];
+  out[i] = sum;
+}
+
+static int verify(const double *out) {
+  for (int i = 0; i < DIM; ++i)
+    if (out[i] != golden[i])
+      return i + 1;
+  return 0;
+}
+
+static void clear() {
+  for (int i = 0; i < DIM; ++i)
+    y[i] = z[i] = 0;
+}
+
+static void report(const char *name, unsigned int timer, const double *out) {
+  PRINTF("%-16s %8u cycles %s\n", name, timer,
+         verify(out) ? "FAILED" : "ok");
+}
+
+int main() {
+  const unsigned int cid = snrt_cluster_core_idx();
+
+  __snrt_omp_bootstrap(cid);
+
+  x = (double *)snrt_l1alloc(DIM * sizeof(double));
+  y = (double *)snrt_l1alloc(DIM * sizeof(double));
+  z = (double *)snrt_l1alloc(DIM * sizeof(double));
+  golden = (double *)snrt_l1alloc(DIM * sizeof(double));
+
+  for (int i = 0; i < DIM; ++i)
+    x[i] = (double)(i % 5) - 2.0;
+  for (int i = 0; i < DIM; ++i)
+    trmv_row(golden, i);
+
+  unsigned int timer;
+  int errors = 0;
+
+  PRINTF("\n----- (%d) triangular mv, %u threads -----\n", DIM,
+         snrt_cluster_compute_core_num());
+
+  clear();
+  timer = benchmark_get_cycle();
+#pragma omp parallel for schedule(static)
+  for (int i = 0; i < DIM; ++i)
+    trmv_row(y, i);
+  timer = benchmark_get_cycle() - timer;
+  report("static", timer, y);
+  errors += verify(y) != 0;
+
+  clear();
+  timer = benchmark_get_cycle();
+#pragma omp parallel for schedule(static, 4)
+  for (int i = 0; i < DIM; ++i)
+    trmv_row(y, i);
+  timer = benchmark_get_cycle() - timer;
+  report("static,4", timer, y);
+  errors += verify(y) != 0;
+
+  clear();
+  timer = benchmark_get_cycle();
+#pragma omp parallel for schedule(dynamic, 1)
+  for (int i = 0; i < DIM; ++i)
+    trmv_row(y, i);
+  timer = benchmark_get_cycle() - timer;
+  report("dynamic,1", timer, y);
+  errors += verify(y) != 0;
+
+  clear();
+  timer = benchmark_get_cycle();
+#pragma omp parallel for schedule(dynamic, 8)
+  for (int i = 0; i < DIM; ++i)
+    trmv_row(y, i);
+  timer = benchmark_get_cycle() - timer;
+  report("dynamic,8", timer, y);
+  errors += verify(y) != 0;
+
+  clear();
+  timer = benchmark_get_cycle();
+#pragma omp parallel for schedule(guided)
+  for (int i = 0; i < DIM; ++i)
+    trmv_row(y, i);
+  timer = benchmark_get_cycle() - timer;
+  report("guided", timer, y);
+  errors += verify(y) != 0;
+
+  // Two independent loops, with the implicit barrier between them
+  clear();
+  timer = benchmark_get_cycle();
+#pragma omp parallel
+  {
+#pragma omp for schedule(dynamic, 8)
+    for (int i = 0; i < DIM; ++i)
+      trmv_row(y, i);
+#pragma omp for schedule(dynamic, 8)
+    for (int i = 0; i < DIM; ++i)
+      trmv_row(z, DIM - 1 - i);
+  }
+  timer = benchmark_get_cycle() - timer;
+  report("2x dynamic,8", timer, z);
+  errors += verify(y) != 0 || verify(z) != 0;
+
+  // ... and without it
+  clear();
+  timer = benchmark_get_cycle();
+#pragma omp parallel
+  {
+#pragma omp for schedule(dynamic, 8) nowait
+    for (int i = 0; i < DIM; ++i)
+      trmv_row(y, i);
+#pragma omp for schedule(dynamic, 8)
+    for (int i = 0; i < DIM; ++i)
+      trmv_row(z, DIM - 1 - i);
+  }
+  timer = benchmark_get_cycle() - timer;
+  report("2x ... nowait", timer, z);
+  errors += verify(y) != 0 || verify(z) != 0;
+
+  __snrt_omp_destroy(cid);
+
+  return errors;
+}
@@ -0,0 +1,45 @@
+// Copyright 2023 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "vadd.h"
+
+// 64-bit vector addition: c = a + b
+void vadd_v64b(double *c, const double *a, const double *b,
+               unsigned int avl) {
+  unsigned int vl;
+
+  // Stripmine
+  do {
+    // Set the vl
+    asm volatile("vsetvli %0, %1, e64, m8, ta, ma" : "=r"(vl) : "r"(avl));
+
+    // Load vectors
+    asm volatile("vle64.v v0, (%0)" ::"r"(a));
+    asm volatile("vle64.v v8, (%0)" ::"r"(b));
+
+    // Add
+    asm volatile("vfadd.vv v16, v0, v8");
+
+    // Store results
+    asm volatile("vse64.v v16, (%0)" ::"r"(c));
+
+    // Bump pointers
+    a += vl;
+    b += vl;
+    c += vl;
+    avl -= vl;
+  } while (avl > 0);
+}
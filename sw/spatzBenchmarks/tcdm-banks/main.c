@@ -0,0 +1,148 @@
+// Copyright 2023 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// TCDM bank placement: streams c = a + b once with all three buffers
+// starting in the same bank, and once with their bases staggered across the
+// banks, and reports the TCDM congestion counter of both runs.
+
+#include <benchmark.h>
+#include <debug.h>
+#include <perf_cnt.h>
+#include <snrt.h>
+#include <stdio.h>
+
+#include "kernel/vadd.c"
+
+#define DIM 1024
+
+static double *a;
+static double *b;
+static double *c;
+
+static unsigned int run(const char *name) {
+  const unsigned int num_cores = snrt_cluster_core_num();
+  const unsigned int cid = snrt_cluster_core_idx();
+  const unsigned int dim_core = DIM / num_cores;
+
+  unsigned int timer = 0;
+
+  if (cid == 0) {
+    for (unsigned int i = 0; i < DIM; i++) {
+      a[i] = (double)i;
+      b[i] = (double)(DIM - 2 * i);
+      c[i] = 0;
+    }
+  }
+
+  // Wait for all cores to finish
+  snrt_cluster_hw_barrier();
+
+  if (cid == 0) {
+    snrt_reset_perf_counter(SNRT_PERF_CNT0);
+    snrt_start_perf_counter(SNRT_PERF_CNT0, SNRT_PERF_CNT_TCDM_CONGESTED, 0);
+    start_kernel();
+    timer = benchmark_get_cycle();
+  }
+
+  // Wait for all cores to finish
+  snrt_cluster_hw_barrier();
+
+  vadd_v64b(c + dim_core * cid, a + dim_core * cid, b + dim_core * cid,
+            dim_core);
+
+  // Wait for all cores to finish
+  snrt_cluster_hw_barrier();
+
+  unsigned int errors = 0;
+  if (cid == 0) {
+    timer = benchmark_get_cycle() - timer;
+    stop_kernel();
+    snrt_stop_perf_counter(SNRT_PERF_CNT0);
+
+    for (unsigned int i = 0; i < DIM; i++) {
+      if (c[i] != (double)(DIM - i)) {
+        PRINTF("Error: Index %d -> Result = %f, Expected = %f\n", i,
+               (float)c[i], (float)(DIM - i));
+        errors++;
+      }
+    }
+
+    PRINTF("%-9s: a bank %2u, b bank %2u, c bank %2u, %5u cycles, %5u "
+           "congested\n",
+           name, ((unsigned int)a / SNRT_TCDM_BANK_WIDTH) % snrt_l1_bank_num(),
+           ((unsigned int)b / SNRT_TCDM_BANK_WIDTH) % snrt_l1_bank_num(),
+           ((unsigned int)c / SNRT_TCDM_BANK_WIDTH) % snrt_l1_bank_num(),
+           timer, snrt_get_perf_counter(SNRT_PERF_CNT0));
+  }
+
+  // Wait for core 0 to finish displaying results
+  snrt_cluster_hw_barrier();
+
+  return errors;
+}
+
+int main() {
+  const unsigned int cid = snrt_cluster_core_idx();
+  unsigned int errors = 0;
+  snrt_l1_mark_t mark;
+
+  if (cid == 0)
+    PRINTF("\n----- (%d) tcdm-banks -----\n", DIM);
+
+  // All buffers start in the first bank
+  if (cid == 0) {
+    mark = snrt_l1_mark();
+    const unsigned int row = snrt_l1_bank_row();
+    a = (double *)snrt_l1alloc_aligned(DIM * sizeof(double), row);
+    b = (double *)snrt_l1alloc_aligned(DIM * sizeof(double), row);
+    c = (double *)snrt_l1alloc_aligned(DIM * sizeof(double), row);
+    if (!a || !b || !c) {
+      PRINTF("Error: cannot allocate the aligned buffers\n");
+      a = 0;
+    }
+  }
+
+  // Wait for core 0 to allocate the buffers
+  snrt_cluster_hw_barrier();
+  if (!a)
+    return -1;
+
+  errors += run("aligned");
+
+  // Buffer bases spread over the banks
+  if (cid == 0) {
+    snrt_l1_release(mark);
+    void *bufs[3];
+    const size_t sizes[3] = {DIM * sizeof(double), DIM * sizeof(double),
+                             DIM * sizeof(double)};
+    if (snrt_l1alloc_staggered(bufs, sizes, 3)) {
+      PRINTF("Error: cannot allocate the staggered buffers\n");
+      bufs[0] = bufs[1] = bufs[2] = 0;
+    }
+    a = (double *)bufs[0];
+    b = (double *)bufs[1];
+    c = (double *)bufs[2];
+  }
+
+  // Wait for core 0 to allocate the buffers
+  snrt_cluster_hw_barrier();
+  if (!a)
+    return -1;
+
+  errors += run("staggered");
+
+  return errors;
+}
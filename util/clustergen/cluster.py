@@ -287,6 +287,12 @@ class SnitchCluster(Generator):
             + 3
         )
 
+    def vrf_word_elements(self):
+        """Number of 32-bit DIMC results that fit in one VRF word."""
+        n_fu = max(int(self.cfg["n_ipu"]), int(self.cfg["n_fpu"]))
+        elen = 64 if self.cfg["spatz_fpu"] else 32
+        return n_fu * elen // 32
+
     def parse_pma_cfg(self, pma_cfg):
         self.cfg["pmas"] = dict()
         # print(pma_cfg.regions)
@@ -359,6 +365,16 @@ class SnitchCluster(Generator):
             log.error("The TCDM size must be a power of two.")
         elif is_pow2(self.cfg["tcdm"]["banks"]):
             log.error("The amount of banks must be a power of two.")
+        elif is_pow2(self.cfg["n_dimc"]):
+            log.error("The amount of DIMC macros must be a power of two.")
+        elif is_pow2(self.cfg["n_dimc_kbanks"]):
+            log.error("The amount of DIMC kernel memory banks must be a power of two.")
+        elif int(self.cfg["n_dimc"]) > self.vrf_word_elements():
+            log.error(
+                "`n_dimc` cannot exceed the {} 32-bit results of a VRF word".format(
+                    self.vrf_word_elements()
+                )
+            )
         else:
             failed = False
 
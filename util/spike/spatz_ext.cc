@@ -0,0 +1,401 @@
+// Copyright 2023 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+// Spike extension for the Spatz-specific instructions:
+//
+// - the DIMC instructions (DMV, LD_F, LD_K, LD_KB, DPS, DSS, LD_Q, CFG on the
+//   custom opcode 0x6B, MACVV on 0x5F), executed on the DIMC model of the
+//   testbench library (hw/ip/snitch_test/src/dimc_model.hh) against the
+//   vector registers;
+// - the Snitch DMA instructions (Xdma, opcode 0x2B), executed as instant
+//   copies. Copies into the DIMC kernel window are written into the kernel
+//   memories of the target hart.
+//
+// Usage: spike --extlib=libspatz_ext.so --extension=spatz ...
+//
+// The cluster configuration is taken from the environment:
+//   SPATZ_NDIMC                DIMC macros per hart (`n_dimc`, default 1)
+//   SPATZ_DIMC_KERNEL_BASE     DIMC kernel window (default 0x130000, the end
+//                              of the cluster peripherals of the default
+//                              cluster)
+//   SPATZ_CLUSTER_BASE_HARTID  Hart ID of core 0 (default 0)
+
+#include <riscv/extension.h>
+#include <riscv/mmu.h>
+#include <riscv/processor.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <vector>
+
+#include "dimc_model.hh"
+
+namespace {
+
+using sim::DimcModel;
+
+constexpr unsigned SECTION_BYTES = DimcModel::SECTION_BITS / 8;
+constexpr unsigned SECTION_WORDS = DimcModel::SECTION_WORDS;
+// Bytes of the kernel window assigned to each core
+constexpr reg_t DIMC_CORE_WINDOW = 1 << 15;
+
+unsigned long env_or(const char *name, unsigned long dflt) {
+    const char *value = std::getenv(name);
+    return value ? std::strtoul(value, nullptr, 0) : dflt;
+}
+
+inline uint32_t sext24(uint32_t v) { return uint32_t(int32_t(v << 8) >> 8); }
+
+class spatz_ext_t;
+
+/// Extension instance of every hart, by hart ID.
+std::map<reg_t, spatz_ext_t *> &harts() {
+    static std::map<reg_t, spatz_ext_t *> instances;
+    return instances;
+}
+
+class spatz_ext_t : public extension_t {
+   public:
+    spatz_ext_t() : dimc(env_or("SPATZ_NDIMC", 1)) {}
+
+    const char *name() override { return "spatz"; }
+    std::vector<insn_desc_t> get_instructions() override;
+    std::vector<disasm_insn_t *> get_disasms() override { return {}; }
+
+    void reset() override {
+        for (auto &macro : dimc) macro.reset();
+        dimc_ocfg = 0;
+        dimc_mct = 0;
+        std::memset(dimc_acc, 0, sizeof(dimc_acc));
+        dma_src = dma_dst = 0;
+        dma_src_stride = dma_dst_stride = dma_reps = 0;
+        dma_next_id = 0;
+        harts()[p->get_id()] = this;
+    }
+
+    // DIMC macros of this hart, the selected output stage and tail mask
+    std::vector<DimcModel> dimc;
+    unsigned dimc_ocfg;
+    unsigned dimc_mct;
+    // Accumulator bank of the DMV accumulator modes, one entry per result
+    uint32_t dimc_acc[DimcModel::NR_ROWS];
+
+    // DMA state
+    reg_t dma_src, dma_dst;
+    reg_t dma_src_stride, dma_dst_stride, dma_reps;
+    uint32_t dma_next_id;
+};
+
+spatz_ext_t *ext(processor_t *p) {
+    return static_cast<spatz_ext_t *>(p->get_extension("spatz"));
+}
+
+//================================================================================
+// Vector register file access
+//================================================================================
+
+/// Byte `byte` of the register group starting at `vreg`.
+uint8_t *vrf_byte(processor_t *p, unsigned vreg, reg_t byte) {
+    reg_t vlenb = p->VU.VLEN / 8;
+    reg_t offset = (vreg * vlenb + byte) % (NVPR * vlenb);
+    return static_cast<uint8_t *>(p->VU.reg_file) + offset;
+}
+
+/// Read the 256-bit VRF word `word` of the register group starting at `vreg`.
+void vrf_read_section(processor_t *p, unsigned vreg, unsigned word,
+                      uint64_t *data) {
+    for (unsigned w = 0; w < SECTION_WORDS; ++w)
+        std::memcpy(&data[w],
+                    vrf_byte(p, vreg, word * SECTION_BYTES + w * 8), 8);
+}
+
+uint32_t vrf_read32(processor_t *p, unsigned vreg, unsigned elem) {
+    uint32_t value;
+    std::memcpy(&value, vrf_byte(p, vreg, elem * 4), 4);
+    return value;
+}
+
+void vrf_write32(processor_t *p, unsigned vreg, unsigned elem, uint32_t value) {
+    std::memcpy(vrf_byte(p, vreg, elem * 4), &value, 4);
+}
+
+//================================================================================
+// DIMC
+//================================================================================
+
+const uint64_t FULL_MASK[SECTION_WORDS] = {~0ull, ~0ull, ~0ull, ~0ull};
+
+/// DPS/DSS/DMV. A single compute returns the result of kernel row `row` of
+/// macro m in element (elem + m) of vd. DMV sweeps the rows starting at `row`
+/// and writes 32 results to the vd register group, or packs them into the
+/// first VRF word of vd with a narrow output stage. flags[4:3] of DMV select
+/// the accumulator mode: 1 accumulates without writing vd, 2 adds the
+/// accumulators to the results and clears them, 3 only drains them.
+void dimc_compute(spatz_ext_t *e, processor_t *p, bool dss, bool loop,
+                  unsigned vd, unsigned vs1, unsigned flags, unsigned row,
+                  unsigned imm) {
+    unsigned mode = ((imm & 0x3) << 2) | (flags & 0x3);
+    unsigned nr_macros = e->dimc.size();
+    bool psin = loop ? (flags & 0x4) : dss && (vs1 & 0x2);
+
+    if (!loop) {
+        unsigned elem = (flags >> 2) & 0x7;
+        uint32_t bias[8];
+        for (unsigned m = 0; m < nr_macros; ++m)
+            bias[m] = dss ? (psin ? vrf_read32(p, vd, m) : 0)
+                          : vrf_read32(p, vs1, m);
+        for (unsigned m = 0; m < nr_macros; ++m) {
+            auto out = e->dimc[m].compute(row, mode, e->dimc_mct, bias[m],
+                                        e->dimc_ocfg);
+            vrf_write32(p, vd, (elem + m) & 0x7, sext24(out.psout));
+        }
+        return;
+    }
+
+    constexpr unsigned NR_RESULTS = DimcModel::NR_ROWS;
+    unsigned acc_mode = (flags >> 3) & 0x3;
+    uint32_t result[NR_RESULTS];
+    for (unsigned j = 0; j < NR_RESULTS; ++j) {
+        const DimcModel &macro = e->dimc[j % nr_macros];
+        uint32_t bias = acc_mode ? e->dimc_acc[j]
+                                 : (psin ? vrf_read32(p, vd, j) : 0);
+        unsigned r = (row + j / nr_macros) % DimcModel::NR_ROWS;
+        if (acc_mode == 1) {
+            e->dimc_acc[j] = macro.mac(r, mode, e->dimc_mct, bias);
+            continue;
+        }
+        // A drain runs with all sections disabled, leaving the bias
+        uint32_t psum = acc_mode == 3
+                            ? macro.mac(r, DimcModel::MODE_2B, 0, bias, 0)
+                            : macro.mac(r, mode, e->dimc_mct, bias);
+        result[j] = macro.output(r, psum, e->dimc_ocfg).psout;
+        if (acc_mode) e->dimc_acc[j] = 0;
+    }
+    if (acc_mode == 1) return;
+
+    unsigned width = (e->dimc_ocfg >> 2) & 0x3;
+    if (width == DimcModel::OUT_RAW) {
+        for (unsigned j = 0; j < NR_RESULTS; ++j)
+            vrf_write32(p, vd, j, sext24(result[j]));
+        return;
+    }
+
+    // Dense packing, result j at bits [j * b, (j + 1) * b) of vd
+    unsigned bits = 8 >> (width - 1);
+    for (unsigned byte = 0; byte < NR_RESULTS * bits / 8; ++byte) {
+        uint8_t packed = 0;
+        for (unsigned k = 0; k < 8 / bits; ++k) {
+            uint32_t value = result[byte * 8 / bits + k] & ((1u << bits) - 1);
+            packed |= value << (k * bits);
+        }
+        *vrf_byte(p, vd, byte) = packed;
+    }
+}
+
+reg_t dimc_insn(processor_t *p, insn_t insn, reg_t pc) {
+    spatz_ext_t *e = ext(p);
+    uint32_t bits = insn.bits();
+    unsigned funct3 = (bits >> 12) & 0x7;
+    unsigned vd = (bits >> 7) & 0x1f;
+    unsigned vs1 = (bits >> 15) & 0x1f;
+    unsigned imm = bits >> 20;
+    unsigned flags = (imm >> 7) & 0x1f;
+    unsigned row = (imm >> 2) & 0x1f;
+    unsigned sec = imm & 0x3;
+    DimcModel &macro = e->dimc[vd & (e->dimc.size() - 1)];
+    uint64_t data[SECTION_WORDS];
+
+    switch (funct3) {
+        case 0:  // DMV
+            dimc_compute(e, p, true, true, vd, vs1, flags, row, imm);
+            break;
+        case 1:  // LD_F
+            vrf_read_section(p, vs1, flags & 0x1, data);
+            for (auto &m : e->dimc) m.load_feature(sec, data);
+            break;
+        case 2:  // LD_K
+            vrf_read_section(p, vs1, flags & 0x1, data);
+            macro.write_kernel((row << 2) | sec, data, FULL_MASK);
+            break;
+        case 3:  // LD_KB
+            for (unsigned i = 0; i <= flags; ++i) {
+                vrf_read_section(p, vs1, i, data);
+                macro.write_kernel((((row << 2) | sec) + i) & 0x7f, data,
+                                   FULL_MASK);
+            }
+            break;
+        case 4:  // DPS
+        case 5:  // DSS
+            dimc_compute(e, p, funct3 == 5, false, vd, vs1, flags, row, imm);
+            break;
+        case 6: {  // LD_Q
+            if (!(flags & 0x10)) {
+                uint32_t entries[DimcModel::NR_QENTRIES];
+                for (unsigned i = 0; i < DimcModel::NR_QENTRIES; ++i)
+                    entries[i] = vrf_read32(p, vs1, i);
+                macro.load_requant(row >> 3, entries);
+            }
+            e->dimc_ocfg = flags & 0xf;
+            break;
+        }
+        case 7:  // CFG, imm12[11:8] selects the register
+            if ((flags >> 1) == 0)
+                e->dimc_mct = p->get_state()->XPR[insn.rs1()] & 0xff;
+            break;
+    }
+    return pc + 4;
+}
+
+/// MACVV: load feature sections 0-1 from vs1 and kernel sections 0-1 of rows
+/// 0-7 from the register group at vs2 into macro 0, then write the raw partial
+/// sums of the eight rows to the first eight elements of vd. funct7[3] adds
+/// these elements as partial sums.
+///
+/// Bits [5:0] of the opcode mark a 48-bit instruction for Spike, which fetches
+/// 16 bits past it; the handler moves on by 4 bytes as the hardware does.
+reg_t dimc_macvv(processor_t *p, insn_t insn, reg_t pc) {
+    spatz_ext_t *e = ext(p);
+    uint32_t bits = insn.bits();
+    unsigned vd = (bits >> 7) & 0x1f;
+    unsigned vs1 = (bits >> 15) & 0x1f;
+    unsigned vs2 = (bits >> 20) & 0x1f;
+    unsigned funct7 = (bits >> 25) & 0x7f;
+    unsigned mode = ((funct7 >> 4) & 0x3) << 2 | (funct7 & 0x3);
+    DimcModel &macro = e->dimc[0];
+    uint64_t data[SECTION_WORDS];
+
+    for (unsigned s = 0; s < 2; ++s) {
+        vrf_read_section(p, vs1, s, data);
+        macro.load_feature(s, data);
+    }
+    for (unsigned i = 0; i < 16; ++i) {
+        vrf_read_section(p, vs2, i, data);
+        macro.write_kernel(((i >> 1) << 2) | (i & 0x1), data, FULL_MASK);
+    }
+
+    for (unsigned r = 0; r < 8; ++r) {
+        uint32_t bias = (funct7 & 0x8) ? vrf_read32(p, vd, r) : 0;
+        auto out = macro.compute(r, mode, 0, bias, DimcModel::OUT_RAW);
+        vrf_write32(p, vd, r, sext24(out.psout));
+    }
+    return pc + 4;
+}
+
+//================================================================================
+// DMA
+//================================================================================
+
+/// Write one byte into the DIMC kernel window. Writes to cores outside the
+/// cluster are dropped, like in the hardware.
+void dimc_window_write(reg_t offset, uint8_t value) {
+    reg_t base_hartid = env_or("SPATZ_CLUSTER_BASE_HARTID", 0);
+    auto target = harts().find(base_hartid + offset / DIMC_CORE_WINDOW);
+    if (target == harts().end()) return;
+
+    auto &dimc = target->second->dimc;
+    DimcModel &macro = dimc[(offset >> 12) & (dimc.size() - 1)];
+    unsigned byte = offset % SECTION_BYTES;
+    uint64_t data[SECTION_WORDS] = {}, mask[SECTION_WORDS] = {};
+    data[byte / 8] = uint64_t(value) << (byte % 8 * 8);
+    mask[byte / 8] = uint64_t(0xff) << (byte % 8 * 8);
+    macro.write_kernel((offset >> 5) & 0x7f, data, mask);
+}
+
+/// Execute a (2D) transfer instantly and return its ID.
+uint32_t dma_copy(spatz_ext_t *e, processor_t *p, reg_t size, reg_t cfg) {
+    mmu_t *mmu = p->get_mmu();
+    reg_t window = env_or("SPATZ_DIMC_KERNEL_BASE", 0x130000);
+    reg_t window_size = harts().size() * DIMC_CORE_WINDOW;
+    reg_t reps = (cfg & 0x2) ? e->dma_reps : 1;
+    reg_t addr_mask = p->get_xlen() == 32 ? 0xffffffff : ~reg_t(0);
+
+    for (reg_t r = 0; r < reps; ++r) {
+        reg_t src = e->dma_src + r * e->dma_src_stride;
+        reg_t dst = e->dma_dst + r * e->dma_dst_stride;
+        for (reg_t i = 0; i < size; ++i) {
+            uint8_t value = mmu->load<uint8_t>((src + i) & addr_mask);
+            if (((dst + i) & addr_mask) - window < window_size)
+                dimc_window_write(((dst + i) & addr_mask) - window, value);
+            else
+                mmu->store<uint8_t>((dst + i) & addr_mask, value);
+        }
+    }
+    return e->dma_next_id++;
+}
+
+reg_t dma_status(spatz_ext_t *e, reg_t status) {
+    switch (status & 0x3) {
+        case 0:  // completed ID
+        case 1:  // next ID
+            return e->dma_next_id;
+        default:  // busy, would block
+            return 0;
+    }
+}
+
+reg_t xdma_insn(processor_t *p, insn_t insn, reg_t pc) {
+    spatz_ext_t *e = ext(p);
+    auto &xpr = p->get_state()->XPR;
+    uint32_t bits = insn.bits();
+    unsigned funct7 = bits >> 25;
+    reg_t rs1 = uint32_t(xpr[insn.rs1()]);
+    reg_t rs2 = uint32_t(xpr[insn.rs2()]);
+
+    switch (funct7) {
+        case 0:  // dmsrc
+            e->dma_src = rs1 | (rs2 << 32);
+            break;
+        case 1:  // dmdst
+            e->dma_dst = rs1 | (rs2 << 32);
+            break;
+        case 2:  // dmcpyi
+            xpr.write(insn.rd(), dma_copy(e, p, rs1, insn.rs2()));
+            break;
+        case 3:  // dmcpy
+            xpr.write(insn.rd(), dma_copy(e, p, rs1, rs2));
+            break;
+        case 4:  // dmstati
+            xpr.write(insn.rd(), dma_status(e, insn.rs2()));
+            break;
+        case 5:  // dmstat
+            xpr.write(insn.rd(), dma_status(e, rs2));
+            break;
+        case 6:  // dmstr
+            e->dma_src_stride = rs1;
+            e->dma_dst_stride = rs2;
+            break;
+        case 7:  // dmrep
+            e->dma_reps = rs1;
+            break;
+    }
+    return pc + 4;
+}
+
+insn_desc_t make_insn(insn_bits_t match, insn_bits_t mask, insn_func_t fn) {
+    insn_desc_t desc{};
+    desc.match = match;
+    desc.mask = mask;
+    desc.fast_rv32i = desc.fast_rv64i = desc.fast_rv32e = desc.fast_rv64e = fn;
+    desc.logged_rv32i = desc.logged_rv64i = fn;
+    desc.logged_rv32e = desc.logged_rv64e = fn;
+    return desc;
+}
+
+std::vector<insn_desc_t> spatz_ext_t::get_instructions() {
+    std::vector<insn_desc_t> insns;
+    // DIMC I-type, all funct3
+    for (unsigned funct3 = 0; funct3 <= 7; ++funct3)
+        insns.push_back(make_insn((funct3 << 12) | 0x6b, 0x707f, dimc_insn));
+    // MACVV, any funct3
+    insns.push_back(make_insn(0x5f, 0x7f, dimc_macvv));
+    // Xdma
+    for (unsigned funct7 = 0; funct7 <= 7; ++funct7)
+        insns.push_back(make_insn((funct7 << 25) | 0x2b, 0xfe00707f, xdma_insn));
+    return insns;
+}
+
+}  // namespace
+
+REGISTER_EXTENSION(spatz, []() { return new spatz_ext_t; })